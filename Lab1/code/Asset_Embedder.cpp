@@ -0,0 +1,91 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Build-time tool that turns asset files into a C++ translation unit: one
+16-byte-aligned byte array per file plus the kEmbeddedAssets table declared
+in ECE_EmbeddedAssets.h. Each asset is keyed by the relative path the game
+would open on disk (e.g. graphics/background.png).
+
+Usage: asset_embedder <out.cpp> <key>=<file> ...
+*/
+
+#include <fstream>             // std::ifstream / std::ofstream for assets and output
+#include <iostream>            // std::cerr for errors
+#include <iterator>            // std::istreambuf_iterator to slurp each asset
+#include <string>              // std::string for keys and paths
+#include <vector>              // std::vector for file contents
+
+/*
+ * Purpose:
+ *      Program entry. Writes the generated translation unit.
+ * Input(s):
+ *      argv - see Usage in the file header
+ * Output:
+ *      int - 0 on success, 1 on bad arguments or unreadable/unwritable files.
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: asset_embedder <out.cpp> <key>=<file> ...\n";
+        return 1;
+    }
+
+    std::vector<std::string> keys;
+    std::vector<std::size_t> sizes;
+    std::string body;                                   // array definitions, built in memory for speed
+    for (int i = 2; i < argc; ++i)
+    { // one array per key=file pair
+        const std::string arg = argv[i];
+        const std::size_t eq  = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            std::cerr << "asset_embedder: expected key=file, got " << arg << "\n";
+            return 1;
+        }
+        std::ifstream in(arg.substr(eq + 1), std::ios::binary);
+        if (!in)
+        {
+            std::cerr << "asset_embedder: cannot read " << arg.substr(eq + 1) << "\n";
+            return 1;
+        }
+        const std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+        body += "// " + arg.substr(0, eq) + "\n";
+        body += "alignas(16) static const unsigned char kAsset" + std::to_string(keys.size()) + "[] =\n{";
+        for (std::size_t b = 0; b < bytes.size(); ++b)
+        {
+            body += (b % 24 == 0) ? "\n    " : "";
+            body += std::to_string(bytes[b]);
+            body += ',';
+        }
+        body += bytes.empty() ? "0\n};\n\n" : "\n};\n\n";    // zero-length arrays are not valid C++
+        keys.push_back(arg.substr(0, eq));
+        sizes.push_back(bytes.size());
+    }
+
+    std::ofstream out(argv[1], std::ios::binary);
+    out << "/*\n"
+           "Generated by asset_embedder. Do not edit.\n"
+           "Asset files compiled into the executable (see ECE_EmbeddedAssets.h).\n"
+           "*/\n\n"
+           "#include \"ECE_EmbeddedAssets.h\"\n\n"
+        << body
+        << "const EmbeddedAsset kEmbeddedAssets[] =\n{\n";
+    for (std::size_t k = 0; k < keys.size(); ++k)
+    {
+        out << "    { \"" << keys[k] << "\", kAsset" << k << ", " << sizes[k] << " },\n";
+    }
+    out << "    { nullptr, nullptr, 0 }   // sentinel, keeps the array non-empty\n"
+           "};\n\n"
+           "const std::size_t kEmbeddedAssetCount = " << keys.size() << ";\n";
+
+    if (!out.good())
+    {
+        std::cerr << "asset_embedder: cannot write " << argv[1] << "\n";
+        return 1;
+    }
+    return 0;
+}
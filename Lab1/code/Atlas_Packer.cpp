@@ -0,0 +1,243 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Build-time tool that packs the gameplay sprites into a single texture atlas
+and writes a C++ header with each sprite's sub-rectangle. Sprites larger
+than the size limit are box-filtered down first (they are never drawn
+bigger than about a tenth of the window), which cuts texture memory.
+
+Usage: atlas_packer <atlas.png> <rects.h> <maxSide> <Name>=<image.png> ...
+*/
+
+#include <SFML/Graphics.hpp>   // sf::Image for PNG load/save (CPU only, no window needed)
+#include <algorithm>           // std::sort / std::max / std::min
+#include <cmath>               // std::lround for scaled sizes
+#include <cstdlib>             // std::atoi
+#include <fstream>             // std::ofstream for the generated header
+#include <iostream>            // std::cerr for errors
+#include <string>              // std::string for names and paths
+#include <vector>              // std::vector for the sprite list
+
+/*
+ * Purpose:
+ *      One sprite being packed.
+ * Fields:
+ *      name       - identifier used in the generated enum (AtlasName)
+ *      image      - pixels after any downscale
+ *      sourceSize - size of the original PNG (what gameplay hitboxes use)
+ *      x, y       - placement in the atlas
+ */
+struct PackItem
+{
+    std::string  name;
+    sf::Image    image;
+    sf::Vector2u sourceSize;
+    unsigned int x = 0, y = 0;
+};
+
+/*
+ * Purpose:
+ *      Shrinks an image so its longer side is at most maxSide, averaging
+ *      every source pixel that falls in each destination pixel. Color is
+ *      weighted by alpha so transparent borders do not darken edges.
+ * Input(s):
+ *      const sf::Image& src - source image
+ *      unsigned int maxSide - longest allowed side in pixels
+ * Output:
+ *      sf::Image - the (possibly) smaller image
+ */
+static sf::Image downscale(const sf::Image& src, unsigned int maxSide)
+{
+    const sf::Vector2u s = src.getSize();
+    const unsigned int longest = std::max(s.x, s.y);
+    if (longest <= maxSide)
+    { // already small enough
+        return src;
+    }
+
+    const double f  = static_cast<double>(maxSide) / longest;
+    const unsigned int dw = std::max(1u, static_cast<unsigned int>(std::lround(s.x * f)));
+    const unsigned int dh = std::max(1u, static_cast<unsigned int>(std::lround(s.y * f)));
+
+    const sf::Uint8* in = src.getPixelsPtr();
+    std::vector<sf::Uint8> out(static_cast<std::size_t>(dw) * dh * 4);
+
+    for (unsigned int y = 0; y < dh; ++y)
+    {
+        const unsigned int y0 = y * s.y / dh, y1 = std::max(y0 + 1, (y + 1) * s.y / dh);
+        for (unsigned int x = 0; x < dw; ++x)
+        {
+            const unsigned int x0 = x * s.x / dw, x1 = std::max(x0 + 1, (x + 1) * s.x / dw);
+            double r = 0, g = 0, b = 0, a = 0;
+            for (unsigned int sy = y0; sy < y1; ++sy)
+            {
+                for (unsigned int sx = x0; sx < x1; ++sx)
+                {
+                    const sf::Uint8* p = in + (static_cast<std::size_t>(sy) * s.x + sx) * 4;
+                    const double pa = p[3];
+                    r += p[0] * pa; g += p[1] * pa; b += p[2] * pa; a += pa;
+                }
+            }
+            const double n = static_cast<double>(x1 - x0) * (y1 - y0);
+            sf::Uint8* q = &out[(static_cast<std::size_t>(y) * dw + x) * 4];
+            q[0] = static_cast<sf::Uint8>(a > 0 ? r / a : 0);
+            q[1] = static_cast<sf::Uint8>(a > 0 ? g / a : 0);
+            q[2] = static_cast<sf::Uint8>(a > 0 ? b / a : 0);
+            q[3] = static_cast<sf::Uint8>(a / n + 0.5);
+        }
+    }
+
+    sf::Image dst;
+    dst.create(dw, dh, out.data());
+    return dst;
+}
+
+/*
+ * Purpose:
+ *      Shelf-packs the items (tallest first) into rows of the given width.
+ * Input(s):
+ *      vector<PackItem*>& items - items sorted by height, placements written back
+ *      unsigned int width       - atlas width in pixels
+ *      unsigned int pad         - gap between sprites in pixels
+ * Output:
+ *      unsigned int - atlas height needed
+ */
+static unsigned int shelfPack(std::vector<PackItem*>& items, unsigned int width, unsigned int pad)
+{
+    unsigned int x = pad, y = pad, shelfH = 0;
+    for (PackItem* it : items)
+    {
+        const sf::Vector2u s = it->image.getSize();
+        if (x + s.x + pad > width)
+        { // row full: start a new shelf
+            x = pad;
+            y += shelfH + pad;
+            shelfH = 0;
+        }
+        it->x = x;
+        it->y = y;
+        x += s.x + pad;
+        shelfH = std::max(shelfH, s.y);
+    }
+    return y + shelfH + pad;
+}
+
+/*
+ * Purpose:
+ *      Program entry: load, downscale, pack, write atlas PNG and rect header.
+ * Input(s):
+ *      argv - see Usage in the file header
+ * Output:
+ *      int - 0 on success, 1 on any failure (fails the build)
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 5)
+    {
+        std::cerr << "usage: atlas_packer <atlas.png> <rects.h> <maxSide> <Name>=<image.png> ...\n";
+        return 1;
+    }
+    const std::string atlasPath  = argv[1];
+    const std::string headerPath = argv[2];
+    const unsigned int maxSide   = static_cast<unsigned int>(std::max(1, std::atoi(argv[3])));
+    const unsigned int pad       = 2;                   // transparent gap so filtering never bleeds between sprites
+
+    std::vector<PackItem> items;
+    for (int i = 4; i < argc; ++i)
+    { // load each Name=path pair
+        const std::string arg = argv[i];
+        const std::size_t eq  = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            std::cerr << "atlas_packer: expected Name=path, got " << arg << "\n";
+            return 1;
+        }
+        PackItem item;
+        item.name = arg.substr(0, eq);
+        sf::Image src;
+        if (!src.loadFromFile(arg.substr(eq + 1)))
+        {
+            std::cerr << "atlas_packer: cannot load " << arg.substr(eq + 1) << "\n";
+            return 1;
+        }
+        item.sourceSize = src.getSize();
+        item.image      = downscale(src, maxSide);
+        items.push_back(item);
+    }
+
+    std::vector<PackItem*> order;
+    for (auto& item : items)
+    {
+        order.push_back(&item);
+    }
+    std::sort(order.begin(), order.end(), [](const PackItem* a, const PackItem* b)
+    { // tallest first keeps shelves tight
+        return a->image.getSize().y > b->image.getSize().y;
+    });
+
+    unsigned int bestW = 0, bestH = 0;
+    for (unsigned int w = 64; w <= 4096; w *= 2)
+    { // smallest-area power-of-two width that fits every sprite
+        unsigned int widest = 0;
+        for (const auto& item : items)
+        {
+            widest = std::max(widest, item.image.getSize().x + 2 * pad);
+        }
+        if (w < widest)
+        {
+            continue;
+        }
+        const unsigned int h = shelfPack(order, w, pad);
+        if (bestW == 0 || static_cast<unsigned long>(w) * h < static_cast<unsigned long>(bestW) * bestH)
+        {
+            bestW = w;
+            bestH = h;
+        }
+    }
+    shelfPack(order, bestW, pad);                       // redo the winning layout
+
+    sf::Image atlas;
+    atlas.create(bestW, bestH, sf::Color(0, 0, 0, 0));
+    for (const auto& item : items)
+    {
+        atlas.copy(item.image, item.x, item.y);
+    }
+    if (!atlas.saveToFile(atlasPath))
+    {
+        std::cerr << "atlas_packer: cannot write " << atlasPath << "\n";
+        return 1;
+    }
+
+    std::ofstream h(headerPath);
+    h << "/*\n"
+         "Generated by atlas_packer from Lab1/graphics. Do not edit.\n"
+         "Sub-rectangles of each gameplay sprite inside graphics/atlas.png, plus\n"
+         "the size of the original PNG (gameplay hitboxes are based on it).\n"
+         "*/\n\n"
+         "#pragma once\n\n"
+         "#include <SFML/Graphics/Rect.hpp>\n"
+         "#include <SFML/System/Vector2.hpp>\n\n"
+         "enum AtlasSprite\n{\n";
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+        h << "    Atlas" << items[i].name << " = " << i << ",\n";
+    }
+    h << "    AtlasCount = " << items.size() << "\n};\n\n"
+         "struct AtlasEntry\n{\n"
+         "    sf::IntRect  rect;         // pixels inside the atlas\n"
+         "    sf::Vector2u sourceSize;   // original PNG size\n"
+         "};\n\n"
+         "static const char* const kAtlasFile = \"graphics/atlas.png\";\n\n"
+         "static const AtlasEntry kAtlas[AtlasCount] =\n{\n";
+    for (const auto& item : items)
+    {
+        const sf::Vector2u s = item.image.getSize();
+        h << "    { sf::IntRect(" << item.x << ", " << item.y << ", " << s.x << ", " << s.y << "), "
+          << "sf::Vector2u(" << item.sourceSize.x << ", " << item.sourceSize.y << ") },   // " << item.name << "\n";
+    }
+    h << "};\n";
+
+    return h.good() ? 0 : 1;
+}
@@ -0,0 +1,320 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Micro-benchmarks for the game-loop systems. Each system in GameSystems.h
+(plus quad batching) is run on synthetic swarms and shot counts from tens up
+to 100k, and the results are printed as JSON (ns per call, items per second)
+so runs from different versions can be diffed for regressions.
+
+Only the system call itself is timed; rebuilding the input (fresh swarm,
+refilled pools) happens between timed calls.
+
+Usage: buzzy_bench [minSeconds=0.2] [nameFilter]
+*/
+
+#include <SFML/Graphics.hpp>   // sf::Texture as the batching key (never uploaded)
+#include <algorithm>           // std::max for iteration counts
+#include <chrono>              // std::chrono::steady_clock for timing
+#include <cmath>               // std::ceil / std::sqrt for swarm layout
+#include <cstdio>              // std::printf for the JSON report
+#include <cstdlib>             // std::atof for arguments
+#include <random>              // std::mt19937 for reproducible synthetic shots
+#include <string>              // std::string for benchmark names
+#include <vector>              // std::vector for collected results
+
+#include "ECE_LaserKernels.h"  // laserKernelIsa for the report context
+#include "ECE_SpriteBatch.h"   // Quad batching (drawScene's hot path)
+#include "GameSystems.h"       // Systems under test
+
+using BenchClock = std::chrono::steady_clock;   // named apart from sf::Clock (Graphics.hpp pulls it in)
+
+/*
+ * Purpose:
+ *      One benchmark result row.
+ * Fields:
+ *      name       - "<system>/<items>"
+ *      items      - items processed per call (enemies or shots)
+ *      iterations - timed calls
+ *      nsPerOp    - mean wall time per call in nanoseconds
+ */
+struct BenchResult
+{
+    std::string name;
+    std::size_t items;
+    long        iterations;
+    double      nsPerOp;
+};
+
+/*
+ * Purpose:
+ *      Times op() until at least minSeconds of measured time has elapsed,
+ *      calling setup() untimed before every call.
+ * Input(s):
+ *      const std::string& name - benchmark name
+ *      std::size_t items       - items processed per call
+ *      double minSeconds       - minimum measured time
+ *      Setup setup             - rebuilds the input (not timed)
+ *      Op op                   - system call under test (timed)
+ * Output:
+ *      BenchResult - mean time per call
+ */
+template <typename Setup, typename Op>
+static BenchResult runBench(const std::string& name, std::size_t items, double minSeconds, Setup setup, Op op)
+{
+    setup();
+    op();                                               // warm-up: touch memory, size any lazy buffers
+
+    double measured = 0.0;
+    long iterations = 0;
+    const BenchClock::time_point wallStart = BenchClock::now();
+    while (measured < minSeconds || iterations < 3)
+    { // keep going until enough timed samples
+        setup();
+        const BenchClock::time_point t0 = BenchClock::now();
+        op();
+        measured += std::chrono::duration<double>(BenchClock::now() - t0).count();
+        ++iterations;
+
+        if (std::chrono::duration<double>(BenchClock::now() - wallStart).count() > 20.0 * minSeconds && iterations >= 3)
+        { // setup dominates (large sizes): stop on wall time instead
+            break;
+        }
+    }
+    return {name, items, iterations, measured * 1e9 / iterations};
+}
+
+/*
+ * Purpose:
+ *      Config for a synthetic swarm of about n enemies laid out on the
+ *      usual 120 px grid, with a window big enough to hold it.
+ * Input(s):
+ *      std::size_t n - enemy count
+ * Output:
+ *      GameConfig - default tuning with enlarged grid and window
+ */
+static GameConfig syntheticConfig(std::size_t n)
+{
+    GameConfig config;
+    const int cols = std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(n)))));
+    const int rows = static_cast<int>((n + cols - 1) / cols);
+    config.enemyCols = cols;
+    config.enemyRows = rows;
+
+    // createEnemies starts at (120, 0.65 * height) and spaces enemies 120 px apart
+    const unsigned int width  = std::max(config.windowSize.x, static_cast<unsigned int>(120 * (cols + 2)));
+    const unsigned int height = std::max(config.windowSize.y, static_cast<unsigned int>((120 * (rows + 1)) / 0.35f));
+    config.windowSize = {width, height};
+    return config;
+}
+
+/*
+ * Purpose:
+ *      Same grid layout as createEnemies, but with enemies sized for the
+ *      default 1920x1080 window. createEnemies scales sprites to the window,
+ *      so on the enlarged synthetic window every enemy would be thousands of
+ *      pixels wide and overlap most of the swarm.
+ * Input(s):
+ *      ECE_EnemySwarm& enemies   - output swarm (cleared & filled)
+ *      const GameConfig& config  - synthetic grid and window
+ * Output:
+ *      None
+ */
+static void makeSyntheticSwarm(ECE_EnemySwarm& enemies, const GameConfig& config)
+{
+    const Vector2u gameWindow = GameConfig().windowSize;
+    const Vector2f half1 = enemyHalfExtents(config.enemy1TexSize, gameWindow);
+    const Vector2f half2 = enemyHalfExtents(config.enemy2TexSize, gameWindow);
+    const float    startY = config.windowSize.y * 0.65f;
+
+    enemies.clear();
+    enemies.reserve(static_cast<std::size_t>(config.enemyCols) * config.enemyRows);
+    for (int r = 0; r < config.enemyRows; ++r)
+    {
+        for (int c = 0; c < config.enemyCols; ++c)
+        {
+            const bool even = (r % 2 == 0);
+            enemies.add({120.f + c * 120.f, startY + r * 120.f}, even ? half1 : half2, even ? Enemy1 : Enemy2, c);
+        }
+    }
+}
+
+/*
+ * Purpose:
+ *      Fills a pool with n shots at random positions inside an area.
+ * Input(s):
+ *      ECE_LaserPool& pool     - pool to refill (cleared first)
+ *      std::size_t n           - shot count
+ *      const FloatRect& area   - region to scatter the shots over
+ *      float speed             - vertical speed (sign picks direction)
+ *      std::mt19937& rng       - random source
+ * Output:
+ *      None
+ */
+static void fillShots(ECE_LaserPool& pool, std::size_t n, const FloatRect& area, float speed, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> x(area.left, area.left + area.width);
+    std::uniform_real_distribution<float> y(area.top,  area.top  + area.height);
+    pool.clear();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        pool.spawn({x(rng), y(rng)}, {0.f, speed});
+    }
+}
+
+/*
+ * Purpose:
+ *      Program entry. Runs every benchmark whose name contains the filter
+ *      and prints the JSON report to stdout.
+ * Input(s):
+ *      argv[1] - minimum measured seconds per benchmark (default 0.2)
+ *      argv[2] - substring filter on benchmark names (default: all)
+ * Output:
+ *      int - 0 on success.
+ */
+int main(int argc, char** argv)
+{
+    const double      minSeconds = (argc > 1) ? std::max(0.001, std::atof(argv[1])) : 0.2;
+    const std::string filter     = (argc > 2) ? argv[2] : "";
+    const std::size_t sizes[]    = {10, 100, 1000, 10000, 100000};
+    const float       dt         = 1.f / 120.f;
+
+    ECE_ThreadPool   workers;                       // one per core, for the parallel variants
+    ECE_ShotResolver resolver;                      // claim scratch shared by both collision variants
+
+    std::vector<BenchResult> results;
+    auto wanted = [&](const std::string& name)
+    {
+        return filter.empty() || name.find(filter) != std::string::npos;
+    };
+
+    for (const std::size_t n : sizes)
+    {
+        const GameConfig config = syntheticConfig(n);
+        const Vector2u   area   = config.windowSize;
+        const FloatRect  screen(0.f, 0.f, static_cast<float>(area.x), static_cast<float>(area.y));
+        const Vector2f   laserHalf = laserHalfExtents(config.laserTexSize);
+        std::mt19937     rng(12345u + static_cast<unsigned int>(n));
+
+        ECE_EnemySwarm enemies;
+        makeSyntheticSwarm(enemies, config);
+        const ECE_EnemySwarm freshSwarm = enemies;          // template restored before destructive runs
+
+        ECE_UniformGrid grid;
+        grid.configure(broadphaseCellSize(enemies), area);
+
+        ECE_LaserPool playerShots(n, laserHalf);
+        ECE_LaserPool enemyShots(n, laserHalf);
+        const ECE_Buzzy buzzy = makeBuzzy(config);
+
+        std::string name = "createEnemies/" + std::to_string(n);
+        if (wanted(name))
+        {
+            ECE_EnemySwarm created;
+            createEnemies(created, config);
+            results.push_back(runBench(name, created.size(), minSeconds,
+                [] {},
+                [&] { createEnemies(created, config); }));
+        }
+
+        name = "updateShots/" + std::to_string(n);
+        if (wanted(name))
+        { // half player shots, half enemy shots; a few leave the screen each call
+            results.push_back(runBench(name, n, minSeconds,
+                [&] { fillShots(playerShots, n / 2, screen, config.playerShotSpeed, rng);
+                      fillShots(enemyShots, n - n / 2, screen, config.enemyShotSpeed, rng); },
+                [&] { updateShots(playerShots, enemyShots, dt);
+                      cullShots(playerShots, enemyShots, static_cast<float>(area.y)); }));
+        }
+
+        name = "updateEnemies/" + std::to_string(n);
+        if (wanted(name))
+        {
+            float speedX = config.enemySpeedX;
+            int   dir    = +1;
+            results.push_back(runBench(name, freshSwarm.size(), minSeconds,
+                [] {},
+                [&] { updateEnemies(enemies, dt, static_cast<float>(area.x), speedX, dir, config.stepUp); }));
+        }
+
+        name = "gridBuild/" + std::to_string(n);
+        if (wanted(name))
+        {
+            enemies = freshSwarm;
+            results.push_back(runBench(name, freshSwarm.size(), minSeconds,
+                [] {},
+                [&] { grid.build(enemies); }));
+        }
+
+        name = "checkPlayerShotCollisions/" + std::to_string(n);
+        if (wanted(name))
+        { // n shots over n enemies; shots that hit kill an enemy, so restore both every call
+            results.push_back(runBench(name, n, minSeconds,
+                [&] { enemies = freshSwarm;
+                      grid.build(enemies);
+                      fillShots(playerShots, n, screen, config.playerShotSpeed, rng); },
+                [&] { checkPlayerShotCollisions(playerShots, enemies, grid, resolver, nullptr); }));
+        }
+
+        name = "checkPlayerShotCollisionsParallel/" + std::to_string(n);
+        if (wanted(name))
+        { // same scene, search spread over every core (same kills as the serial run)
+            results.push_back(runBench(name, n, minSeconds,
+                [&] { enemies = freshSwarm;
+                      grid.build(enemies);
+                      fillShots(playerShots, n, screen, config.playerShotSpeed, rng); },
+                [&] { checkPlayerShotCollisions(playerShots, enemies, grid, resolver, &workers); }));
+        }
+
+        name = "checkEnemyShotCollisions/" + std::to_string(n);
+        if (wanted(name))
+        { // shots spread over the lower half, so some share the player's row; timed with the per-tick sync
+            ECE_SweepAxis axis;
+            results.push_back(runBench(name, n, minSeconds,
+                [&] { if (enemyShots.size() != n)
+                      {
+                          fillShots(enemyShots, n, {0.f, screen.height * 0.5f, screen.width, screen.height * 0.5f},
+                                    config.enemyShotSpeed, rng);
+                      } },
+                [&] { axis.sync(enemyShots);
+                      checkEnemyShotCollisions(enemyShots, buzzy, axis); }));
+        }
+
+        name = "spriteBatch/" + std::to_string(n);
+        if (wanted(name))
+        { // drawScene's CPU side: one quad per enemy and per shot into two texture buckets
+            const Texture enemyTex, laserTex;               // only their addresses are used
+            ECE_SpriteBatch batch;
+            enemies = freshSwarm;
+            fillShots(playerShots, n, screen, config.playerShotSpeed, rng);
+            results.push_back(runBench(name, enemies.size() + playerShots.size(), minSeconds,
+                [] {},
+                [&] {
+                    batch.begin();
+                    for (std::size_t k = 0; k < enemies.aliveCount(); ++k)
+                    {
+                        const std::size_t i = enemies.aliveAt(k);
+                        batch.add(enemyTex, enemies.getPosition(i), enemies.getHalfExtents(i), IntRect(0, 0, 64, 64));
+                    }
+                    for (std::size_t i = 0; i < playerShots.size(); ++i)
+                    {
+                        batch.add(laserTex, playerShots.getPosition(i), laserHalf, IntRect(0, 0, 16, 48));
+                    }
+                }));
+        }
+    }
+
+    std::printf("{\n  \"context\": {\"laser_kernels\": \"%s\", \"min_seconds\": %g, \"threads\": %zu},\n  \"benchmarks\": [\n",
+                laserKernelIsa(), minSeconds, workers.threadCount());
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchResult& r = results[i];
+        std::printf("    {\"name\": \"%s\", \"items\": %zu, \"iterations\": %ld, \"ns_per_op\": %.1f, \"items_per_second\": %.0f}%s\n",
+                    r.name.c_str(), r.items, r.iterations, r.nsPerOp,
+                    r.nsPerOp > 0.0 ? r.items * 1e9 / r.nsPerOp : 0.0,
+                    (i + 1 < results.size()) ? "," : "");
+    }
+    std::printf("  ]\n}\n");
+    return 0;
+}
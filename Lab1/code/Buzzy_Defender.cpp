@@ -1,26 +1,53 @@
 /*
 Author: Liam Long
 Class: ECE4122
-Last Date Modified: 9/22/25
+Last Date Modified: 10/16/26
 Description:
-Main game loop and helpers for "Buzzy_Defender!". Handles asset loading,
-screen scaling, event handling, entity updates (player, enemies, lasers),
-collision detection, win/lose checks, and replay flow.
+SFML front end for "Buzzy_Defender!". Handles asset loading, screen
+scaling, modal screens, turning window events into InputFrames, drawing,
+and replay flow. Gameplay itself runs in the headless GameState core.
+During a round the main thread polls events and steps the simulation, and
+a render thread draws the snapshots it publishes (ECE_SnapshotExchange).
+
+Usage: Lab1 [--record <prefix>] [--disk-assets] [--fps N] [--vsync]
+    --record       save every round's inputs to <prefix>_<n>.bzr (replay
+                   them with buzzy_headless --replay)
+    --disk-assets  prefer files under graphics/ over the copies compiled
+                   into the executable (for modding); embedded copies are
+                   still used for files that are missing on disk
+    --fps          gameplay frame-rate cap (default 60, 0 = uncapped)
+    --vsync        let the display's vertical sync pace frames instead
+
+Unknown options, missing values and a malformed or negative --fps print a
+usage error and exit with 1.
+
+Built with -DBUZZY_PROFILING=ON, writes buzzy_trace.json and a per-phase
+timing summary on exit.
 */
 
 // ----------------------------- Includes -----------------------------
 
 #include <SFML/Graphics.hpp>   // SFML rendering primitives: RenderWindow, Texture, Sprite, etc.
-#include <list>                // std::list for laser shot containers (easy erase while iterating)
-#include <vector>              // std::vector for enemy swarm
 #include <stdexcept>           // std::runtime_error for texture load failure
 #include <string>              // std::string for asset paths
-#include <limits>              // std::numeric_limits for ±infinity bounds
-#include <cmath>               // std::isfinite to guard empty-swarm edge case
-
-#include "ECE_Buzzy.h"         // Player sprite class
-#include "ECE_LaserBlast.h"    // Laser blase class
-#include "ECE_Enemy.h"         // Enemy sprite class
+#include <algorithm>           // std::min to cap the frame time
+#include <cstdlib>             // std::strtof for --fps
+#include <cmath>               // std::fmod to drop simulation backlog
+#include <iostream>            // std::cout for the per-round draw-call summary
+#include <random>              // std::random_device for each round's seed
+#include <filesystem>          // std::filesystem::exists for --disk-assets
+#include <functional>          // std::ref / std::cref for the render thread's arguments
+#include <thread>              // std::thread for the render thread
+
+#include "GameState.h"         // Headless simulation core (player, swarm, lasers)
+#include "ECE_SpriteBatch.h"   // Per-texture quad batching for gameplay sprites
+#include "ECE_Profiler.h"      // BUZZY_PROFILE_ZONE frame phase timers
+#include "ECE_EmbeddedAssets.h" // Images compiled into the executable
+#include "ECE_FramePacer.h"    // Gameplay frame-rate limiter and jitter statistics
+#include "ECE_RenderSnapshot.h" // Double-buffered frames handed to the render thread
+#include "ECE_Replay.h"        // Input recording for deterministic replays
+#include "ECE_TextureLoader.h" // Parallel PNG decode at startup
+#include "ECE_AtlasRects.h"    // Generated at build time: sprite sub-rects inside graphics/atlas.png
 
 // using namespace for readability
 using namespace sf;
@@ -47,16 +74,14 @@ enum class GameOutcome
  *      endTex    - lose screen background
  *      winTex    - win screen background
  *      bgTex     - gameplay background
- *      buzzyTex  - player sprite texture
- *      laserTex  - laser sprite texture (used by player and enemies)
- *      enemy1Tex - enemy variant 1
- *      enemy2Tex - enemy variant 2
+ *      atlasTex  - build-time atlas of the gameplay sprites (player, lasers,
+ *                  both enemy variants); sub-rects come from ECE_AtlasRects.h
  * Notes:
  *      Keep this small and so it can be passed by const reference.
  */
 struct allTextures                                                                   // Define a tiny struct for textures so don't have to reload every round
 {
-    Texture startTex, endTex, winTex, bgTex, buzzyTex, laserTex, enemy1Tex, enemy2Tex;
+    Texture startTex, endTex, winTex, bgTex, atlasTex;
 };
 
 // --------------------------- Small Helpers ---------------------------
@@ -78,6 +103,31 @@ static Texture loadTexture(const std::string& path)
     return t;
 }
 
+/*
+ * Purpose:
+ *      Queues one image on the loader, from the executable's embedded copy
+ *      or from disk.
+ * Input(s):
+ *      ECE_TextureLoader& loader - startup loader
+ *      const std::string& path   - relative path, e.g. "graphics/background.png"
+ *      Texture& target           - texture to fill
+ *      bool preferDisk           - use the file on disk when it exists
+ * Output:
+ *      std::size_t - loader request id
+ */
+static std::size_t requestAsset(ECE_TextureLoader& loader,
+                                const std::string& path,
+                                Texture& target,
+                                bool preferDisk)
+{
+    const EmbeddedAsset* embedded = findEmbeddedAsset(path);
+    if (embedded && !(preferDisk && std::filesystem::exists(path)))
+    {
+        return loader.request(path, embedded->data, embedded->size, target);
+    }
+    return loader.request(path, target);
+}
+
 /*
  * Purpose:
  *      Creates a full-screen sprite from a texture sized to the current window.
@@ -106,42 +156,101 @@ static Sprite makeBackground(const Texture& tex, const Vector2u& windowSize)
 
 /*
  * Purpose:
- *      Modal start screen. Waits for Enter to begin, Esc/Close to quit.
+ *      Gets the next event for a modal screen without spinning.
  * Input(s):
  *      RenderWindow& window - active SFML window
- *      Sprite ss            - background sprite to draw (by value is fine)
+ *      Event& e             - receives the event
+ *      bool busy            - background work still wants the loop to run
+ * Output:
+ *      bool - true if e holds an event; false if there was none (busy) or
+ *             the window is gone.
+ * Notes:
+ *      Idle screens block in waitEvent, so they use no CPU or GPU until the
+ *      user does something. While busy, polls at about 200 Hz instead.
+ */
+static bool nextScreenEvent(RenderWindow& window,
+                            Event& e,
+                            bool busy)
+{
+    if (!busy)
+    {
+        return window.waitEvent(e);
+    }
+    if (window.pollEvent(e))
+    {
+        return true;
+    }
+    sleep(milliseconds(5));
+    return false;
+}
+
+/*
+ * Purpose:
+ *      Tells whether an event means a modal screen has to be redrawn.
+ * Input(s):
+ *      const Event& e - event from nextScreenEvent
+ * Output:
+ *      bool - true on resize or regained focus (SFML 2 has no expose
+ *             event; the window contents may be lost while unfocused).
+ */
+static bool needsRedraw(const Event& e)
+{
+    return e.type == Event::Resized || e.type == Event::GainedFocus;
+}
+
+/*
+ * Purpose:
+ *      Modal start screen. Waits for Enter to begin, Esc/Close to quit.
+ * Input(s):
+ *      RenderWindow& window       - active SFML window
+ *      Sprite ss                  - background sprite to draw (by value is fine)
+ *      ECE_TextureLoader& loader  - remaining textures, uploaded as they decode
  * Output:
  *      bool - true to start the game; false to quit.
+ * Notes:
+ *      Draws once, then only on resize/focus; sleeps between events.
  */
 static bool startScreen(RenderWindow& window,
-                        Sprite ss) 
+                        Sprite ss,
+                        ECE_TextureLoader& loader) 
 {
+    bool redraw = true;                                              // first frame
     while (window.isOpen())                                          
     { // Keep start screen until X, Esc, or Enter  is pressed
+        const bool loading = !loader.uploadReady();                  // finishes startup uploads, then idles
+
+        if (redraw)
+        {
+            window.clear();
+            window.draw(ss);
+            window.display();
+            redraw = false;
+        }
+
         Event e;
-        while (window.pollEvent(e))
-        { // infinite loop while one of the following options happen
-            if (e.type == Event::Closed)
-            { // pressed the X in top right of window
-                window.close();
-                return false;
-            }
-            
-            if (e.type == Event::KeyPressed && e.key.code == Keyboard::Escape)
-            { // pressed escape to exit
-                window.close();
-                return false;
-            }
-        
-            if (e.type == Event::KeyPressed && e.key.code == Keyboard::Enter)
-            { // pressed enter to begin playing
-                return true;
-            }
+        if (!nextScreenEvent(window, e, loading))
+        { // nothing happened (or the window went away)
+            continue;
+        }
+
+        if (e.type == Event::Closed)
+        { // pressed the X in top right of window
+            window.close();
+            return false;
         }
         
-        window.clear();
-        window.draw(ss);
-        window.display();
+        if (e.type == Event::KeyPressed && e.key.code == Keyboard::Escape)
+        { // pressed escape to exit
+            window.close();
+            return false;
+        }
+    
+        if (e.type == Event::KeyPressed && e.key.code == Keyboard::Enter)
+        { // pressed enter to begin playing
+            return true;
+        }
+
+        redraw = needsRedraw(e);
     }
     return false;
 }
@@ -154,36 +263,47 @@ static bool startScreen(RenderWindow& window,
  *      Sprite es            - end screen background sprite
  * Output:
  *      bool - true if user wants to play again; false to quit.
+ * Notes:
+ *      Draws once, then only on resize/focus; blocks between events.
  */
 static bool endScreen(RenderWindow& window,
                       Sprite es) 
 {
+    bool redraw = true;                                              // first frame
     while (window.isOpen())                                                     
     { // Keep end screen until Esc or X or Enter is pressed
+        if (redraw)
+        {
+            window.clear();
+            window.draw(es);
+            window.display();
+            redraw = false;
+        }
+
         Event e;
-        while (window.pollEvent(e))
-        { // Keep start screen until "Enter" is pressed
-            if (e.type == Event::Closed)
-            { // pressed the X in top right of window
-                window.close();
-                return false;
-            }
-            
-            if (e.type == Event::KeyPressed && e.key.code == Keyboard::Escape)
-            { // pressed escape to exit
-                window.close();
-                return false;
-            }
-            
-            if (e.type == Event::KeyPressed && e.key.code == Keyboard::Enter)
-            { // pressed enter to begin playing
-                return true;
-            }
+        if (!nextScreenEvent(window, e, false))
+        { // window went away
+            continue;
+        }
+
+        if (e.type == Event::Closed)
+        { // pressed the X in top right of window
+            window.close();
+            return false;
         }
         
-        window.clear();
-        window.draw(es);
-        window.display();
+        if (e.type == Event::KeyPressed && e.key.code == Keyboard::Escape)
+        { // pressed escape to exit
+            window.close();
+            return false;
+        }
+        
+        if (e.type == Event::KeyPressed && e.key.code == Keyboard::Enter)
+        { // pressed enter to begin playing
+            return true;
+        }
+
+        redraw = needsRedraw(e);
     }
     return false;
 }
@@ -199,465 +319,272 @@ static bool endScreen(RenderWindow& window,
  *      bool - true if user wants to play again; false to quit.
  * Notes:
  *      Key mapping can be customized (matches endScreen for consistency).
+ *      Draws once, then only on resize/focus; blocks between events.
  */
 static bool winScreen(RenderWindow& window,
                       Sprite ws) 
 {
+    bool redraw = true;                                              // first frame
     while (window.isOpen())
     { // Keep win screen until Esc or X or Enter is pressed
+        if (redraw)
+        {
+            window.clear();
+            window.draw(ws);
+            window.display();
+            redraw = false;
+        }
+
         Event e;
-        while (window.pollEvent(e))
-        {  // infinite loop while one of the following options happen
-            if (e.type == Event::Closed)
-            { // pressed the X in top right of window
-                window.close();
-                return false;
-            }
-            
-            if (e.type == Event::KeyPressed && e.key.code == Keyboard::Escape)
-            { // pressed escape to exit
-                window.close();
-                return false;
-            }
-            
-            if (e.type == Event::KeyPressed && e.key.code == Keyboard::Enter)
-            { // pressed enter to begin playing
-                return true;            
-            }
+        if (!nextScreenEvent(window, e, false))
+        { // window went away
+            continue;
+        }
+
+        if (e.type == Event::Closed)
+        { // pressed the X in top right of window
+            window.close();
+            return false;
         }
         
-        window.clear();
-        window.draw(ws);
-        window.display();
+        if (e.type == Event::KeyPressed && e.key.code == Keyboard::Escape)
+        { // pressed escape to exit
+            window.close();
+            return false;
+        }
+        
+        if (e.type == Event::KeyPressed && e.key.code == Keyboard::Enter)
+        { // pressed enter to begin playing
+            return true;            
+        }
+
+        redraw = needsRedraw(e);
     }
     return false;
 }
 
 /*
  * Purpose:
- *      Populate the enemy swarm in a grid, scaled relative to the window.
+ *      Polls the event queue and samples the keyboard into one InputFrame.
  * Input(s):
- *      vector<ECE_Enemy>& enemies - output container (cleared & filled)
- *      const Texture& enemyTex1   - texture used on even rows
- *      const Texture& enemyTex2   - texture used on odd rows
- *      Vector2u windowSize        - window dimensions (for scaling and layout)
+ *      RenderWindow& window - active window
+ *      bool& quit           - set when the window was closed or Esc pressed
  * Output:
- *      None (enemies vector is modified).
+ *      InputFrame - movement held and whether fire was pressed this frame.
+ * Notes:
+ *      The window is not closed here: the render thread may be drawing into
+ *      it, so playGame stops that thread first.
  */
-static void createEnemies(std::vector<ECE_Enemy>& enemies,
-                          const Texture& enemyTex1,
-                          const Texture& enemyTex2,
-                          Vector2u windowSize)
+static InputFrame handleEvents(RenderWindow& window, bool& quit)
 {
-    const int   cols       = 8;                    // # cols
-    const int   rows       = 4;                    // # rows
-    const float startY     = windowSize.y * 0.65f; // lower half
-    const float xPadding   = 120.f;                // x spacing between enemies
-    const float yPadding   = 120.f;                // y spacing between enemies
-    const float leftMargin = 120.f;                // horizontal starting offset
-    const float topMargin  = startY;               // vertical starting offest
-
-    enemies.clear();
-    enemies.reserve(cols * rows);   // reserves memory for all enemies
-
-    for (int r = 0; r < rows; ++r)
-    { // create enemies row by row
-        for (int c = 0; c < cols; ++c)
-        { // create enemies in adjacent columns
-            const Texture& enemyTex = (r % 2 == 0) ? enemyTex1 : enemyTex2;     // alternate by row
-            ECE_Enemy enemy(enemyTex);
-            enemy.scaleForWindow(windowSize);                                   // sizes relative to window
-            
-            float x = leftMargin + c * xPadding;    // calculate x position
-            float y = topMargin  + r * yPadding;    // calculate y position
-            enemy.setPosition(x, y);
-            enemies.push_back(enemy);   // add to container
-        }
-    }
-}
+    BUZZY_PROFILE_ZONE("handleEvents");
+    InputFrame input;
 
-
-/*
- * Purpose:
- *      Polls the event queue: handles close/escape and spawns player shots.
- * Input(s):
- *      RenderWindow& window               - active window
- *      const ECE_Buzzy& buzzy             - player (for shot spawn position)
- *      list<ECE_LaserBlast>& playerShots  - output list to append new shots
- *      const Texture& laserTex            - laser texture for new shots
- * Output:
- *      None (window state or playerShots may be modified)
- */
-static void handleEvents(RenderWindow& window,
-                         const ECE_Buzzy& buzzy,
-                         std::list<ECE_LaserBlast>& playerShots,
-                         const Texture& laserTex)
-{
     Event e;
     while (window.pollEvent(e))
     { // infinite loop until one of the following events happen 
         if (e.type == Event::Closed)
         { // pressed the X in top right of window
-            window.close();
+            quit = true;
         }
 
         if (e.type == Event::KeyPressed) {
             if (e.key.code == Keyboard::Escape)
             { // pressed escape to exit
-                window.close();
+                quit = true;
             }
             
             if (e.key.code == Keyboard::Space)
-            { // pressed space bar to spawn a lser
-                ECE_LaserBlast newPlayerShot(laserTex, /*fromPlayer=*/true);                        // spawn a player laser heading downward (+Y)
-                Vector2f p = buzzy.getPosition();
-                newPlayerShot.setPosition(p.x, p.y + buzzy.getGlobalBounds().height * 0.5f + 10.f); // set position of laser to buzzy's tail
-                newPlayerShot.setVelocity({0.f, 400.f});                                            // set velocity of player shot +y (down)
-                playerShots.push_back(newPlayerShot);                                               // add new player shot to player shots container
+            { // pressed space bar to spawn a laser
+                input.fire = true;
             }
         }
     }
-}
 
-/*
- * Purpose:
- *      Periodically spawns an enemy laser from a random alive enemy.
- * Input(s):
- *      Clock& enemyShotsClock           - timer used to control cadence
- *      list<ECE_LaserBlast>& enemyShots - where to push the new laser
- *      vector<ECE_Enemy>& enemies       - used to pick a live shooter
- *      const Texture& laserTex          - texture for the new laser
- * Output:
- *      None (enemyShots is modified; clock is restarted).
- */
-static void spawnEnemyLaser(Clock& enemyShotsClock,
-                            std::list<ECE_LaserBlast>& enemyShots,
-                            std::vector<ECE_Enemy>& enemies,
-                            const Texture& laserTex)
-{
-    std::vector<ECE_Enemy*> alive;
-    for (auto &enemy : enemies)
-    { // loops through all enemies in container
-        if(enemy.isAlive())
-        { // add current enemy to alive container
-            alive.push_back(&enemy);
-        }
-    }
-    
-    if(!alive.empty())
-    { // executes only if there are alive enemies
-        size_t index = std::rand() % alive.size();                                              // forces index into range 0 <= index <= alive.size() - 1
-        ECE_Enemy* shooter = alive[index];                                                      // pick random alive enemy
-        ECE_LaserBlast newEnemyShot(laserTex, /*fromPlayer=*/false);                            // spawn an enemy laser heading downward (-Y)
-        Vector2f p = shooter->getPosition();                                                    // get bounds of alive enemy
-        newEnemyShot.setPosition(p.x, p.y + shooter->getGlobalBounds().height * 0.5f + 10.f);   // set shot position
-        newEnemyShot.setVelocity({0.f, -300.f});                                                // set shot velocity (-y = up)
-        enemyShots.push_back(newEnemyShot);                                                     // add new enemy shot to enemy shots container
-    }
-    
-    enemyShotsClock.restart(); // restart clock interval
-}
-
-/*
- * Purpose:
- *      Update player horizontal movement with clamping to window bounds.
- * Input(s):
- *      ECE_Buzzy& buzzy   - player
- *      float dt           - delta time (seconds)
- *      float windowWidth  - width of the playable area (pixels)
- * Output:
- *      None (buzzy position is changed)
- */
-static void updateBuzzy(ECE_Buzzy& buzzy,
-                        float dt,
-                        float windowWidth)
-{
-    buzzy.update(dt, windowWidth);
+    input.left  = Keyboard::isKeyPressed(Keyboard::Left);   // held keys are sampled, not evented
+    input.right = Keyboard::isKeyPressed(Keyboard::Right);
+    return input;
 }
 
 /*
  * Purpose:
- *      Update laser positions and remove those that leave the screen.
+ *      Blends an entity's previous and current tick positions.
  * Input(s):
- *      list<ECE_LaserBlast>& playerShots - mutable list of player lasers
- *      list<ECE_LaserBlast>& enemyShots  - mutable list of enemy lasers
- *      float dt                          - delta time (seconds)
- *      float windowHeight                - window height (pixels)
+ *      Vector2f prev - position at the start of the tick
+ *      Vector2f cur  - position at the end of the tick
+ *      float alpha   - blend factor in [0,1] (0 = previous, 1 = current)
  * Output:
- *      None (both lists may erase elements)
+ *      Vector2f - position to draw at
  */
-static void updateShots(std::list<ECE_LaserBlast>& playerShots,
-                        std::list<ECE_LaserBlast>& enemyShots,
-                        float dt,
-                        float windowHeight)
+static Vector2f lerp(Vector2f prev, Vector2f cur, float alpha)
 {
-    for (auto it = playerShots.begin(); it != playerShots.end();)
-    { // loops through all shots in player shots container using pointers
-        it->update(dt);
-        if (it->isOffScreen(windowHeight))
-        { // removes shot if it goes off screen
-            it = playerShots.erase(it);
-        }
-        else
-        { // move to next player shot in player shots container
-            ++it;
-        }
-    }
-    
-    for (auto it = enemyShots.begin(); it != enemyShots.end(); )
-    { // loops through all shots in enemy shots container using pointers
-        it->update(dt);
-        if (it->isOffScreen(windowHeight))
-        { // removes shot if it goes off screen
-            it = enemyShots.erase(it);
-        }
-        else
-        { // move to next player shot in player shots container
-            ++it;
-        }
-    }
+    return prev + (cur - prev) * alpha;
 }
 
 /*
  * Purpose:
- *      March the enemy swarm left/right and step vertically when hitting walls.
+ *      Copies what the next frame shows out of the simulation: player,
+ *      enemies, and lasers, at interpolated positions.
  * Input(s):
- *      vector<ECE_Enemy>& enemies - mutable swarm
- *      float dt                   - delta time (seconds)
- *      float windowWidth          - playfield width (pixels)
- *      float& enemySpeedX         - horizontal speed (px/s); passed by ref for tunability
- *      int& dir                   - direction (+1 right, -1 left); flipped on bounce
- *      float stepUp               - vertical step amount when bouncing (negative to move upward)
+ *      const GameState& state - round to capture (player, swarm, lasers)
+ *      float alpha            - fraction of the next tick already elapsed,
+ *                               used to interpolate entity positions
+ *      RenderSnapshot& out    - snapshot to fill (previous contents dropped)
  * Output:
- *      None (enemies move; dir may flip).
+ *      None
  * Notes:
- *      Uses a predictive clamp (nextLeft/nextRight) to avoid “wall slide”.
+ *      Runs on the simulation thread; afterwards the render thread needs
+ *      nothing from GameState. Sprite ids index kAtlas.
  */
-static void updateEnemies(std::vector<ECE_Enemy>& enemies,
-                          float dt,
-                          float windowWidth,
-                          float& enemySpeedX,
-                          int& dir,
-                          float stepUp)
+static void captureScene(const GameState& state, float alpha, RenderSnapshot& out)
 {
-    if (enemies.empty())
-    { // all enemies are dead, nothing to udate
-        return;
+    BUZZY_PROFILE_ZONE("captureScene");
+    out.sprites.clear();
+
+    const ECE_Buzzy& buzzy = state.buzzy();
+    out.sprites.push_back({lerp(buzzy.getPreviousPosition(), buzzy.getPosition(), alpha),
+                           buzzy.getHalfExtents(), AtlasBuzzy});
+
+    const AtlasSprite enemySprite[] = {AtlasBulldog, AtlasTigers};         // indexed by EnemyTexture
+    const ECE_EnemySwarm& enemies = state.enemies();
+    for (std::size_t k = 0; k < enemies.aliveCount(); ++k)
+    { // loops through the live enemies only
+        const std::size_t i = enemies.aliveAt(k);
+        out.sprites.push_back({lerp(enemies.getPreviousPosition(i), enemies.getPosition(i), alpha),
+                               enemies.getHalfExtents(i),
+                               static_cast<std::uint16_t>(enemySprite[enemies.getTexture(i)])});
     }
 
-    float minLeft  = std::numeric_limits<float>::infinity();  // smallest x-coordinate of any alive enemy's left edge
-    float maxRight = -std::numeric_limits<float>::infinity(); // largest x-coordinate of any alive enemy's right edge
-
-    for (const auto& enemy : enemies)
-    { // loops through all enemeis in enemies
-        if (!enemy.isAlive())
-        { // skips if current enemy is dead
-            continue;
+    for (const ECE_LaserPool* shots : {&state.playerShots(), &state.enemyShots()})
+    { // player lasers then enemy lasers
+        for (std::size_t i = 0; i < shots->size(); ++i)
+        { // loops through all live shots
+            out.sprites.push_back({lerp(shots->getPreviousPosition(i), shots->getPosition(i), alpha),
+                                   shots->getHalfExtents(), AtlasLaser});
         }
-        auto gb = enemy.getGlobalBounds();
-        minLeft  = std::min(minLeft,  gb.left);             // update the smallest left edge seen so far
-        maxRight = std::max(maxRight, gb.left + gb.width);  // update the largest right edge seen so far
-    }
-    if (!std::isfinite(minLeft))
-    {
-        return; // no alive enemies
     }
-
-    const float dx       = enemySpeedX * dir * dt;
-    const float nextLeft  = minLeft  + dx;
-    const float nextRight = maxRight + dx;
-
-    if (nextLeft < 0.f || nextRight > windowWidth)
-    { // executes if the next update hits a wall
-        // Compute a horizontal correction that puts the group just inside the window
-        float correctionX = 0.f;
-        if (nextLeft < 0.f)
-        { // next update hits a wall
-            correctionX = -minLeft;                   // push so minLeft == 0
-        }
-        else
-        { // nextRight > windowWidth
-            correctionX = windowWidth - maxRight;    // push so maxRight == windowWidth
-        }
-
-        for (auto& enemy : enemies)
-        { // loops through all the enemies in enemies container
-            if (enemy.isAlive())
-            { // if the enemy is alive, update vertically and horizontally
-                enemy.move(correctionX, stepUp);  // clamp + vertical step
-            }
-        }
-        
-        dir *= -1;    // flip once
-        return;       // no horizontal move this frame beyond the clamp
-    }
-
-    // Normal horizontal move
-    for (auto& enemy : enemies)
-        { // loops through all the enemies in enemies container
-            if (enemy.isAlive())
-            { // if the enemy is alive, update horizontally
-                enemy.move(dx, 0.f);
-            }
-        }
 }
 
 /*
  * Purpose:
- *      Resolve player-shot vs enemy collisions; kill enemy & remove shot.
+ *      Draw one frame from a snapshot: background, then every sprite.
  * Input(s):
- *      list<ECE_LaserBlast>& playerShots - player lasers
- *      vector<ECE_Enemy>& enemies        - enemy swarm
+ *      RenderWindow& window          - target window (active on this thread)
+ *      const Sprite& background      - pre-scaled background
+ *      const RenderSnapshot& scene   - sprites captured by captureScene
+ *      const Texture& atlas          - sprite atlas holding every gameplay sprite
+ *      ECE_SpriteBatch& batch        - reused quad batch
  * Output:
- *      None
+ *      std::size_t - draw calls issued this frame.
+ * Notes:
+ *      Buzzy, enemies and lasers are all quads cut from the one atlas
+ *      texture, so the whole playfield is a single batched draw on top of
+ *      the background. Quad sizes come from the simulation's hitboxes, so
+ *      the atlas may store sprites smaller than their source PNGs.
  */
-static void checkPlayerShotCollisions(std::list<ECE_LaserBlast>& playerShots,
-                                      std::vector<ECE_Enemy>& enemies) 
+static std::size_t drawScene(RenderWindow& window,
+                             const Sprite& background,
+                             const RenderSnapshot& scene,
+                             const Texture& atlas,
+                             ECE_SpriteBatch& batch)
 {
-    for (auto shotIt = playerShots.begin(); shotIt != playerShots.end();)
-    { // loops through all shots in player shots container
-        bool hitEnemy = false;
-        const FloatRect playerShotBounds = shotIt->getGlobalBounds();
-        
-        for (auto& enemy : enemies)
-        { // loops through all enemies in enemies container
-            if (enemy.isAlive())
-            { // only considers enemies that are alive
-                if (playerShotBounds.intersects(enemy.getGlobalBounds()))
-                { // kills enemy if the current player shot intersects with the current enemy's bounds
-                    enemy.kill();
-                    shotIt = playerShots.erase(shotIt);                             // removes the element at the iterator's position and returns a new iterator that points to the element after the erased one
-                    hitEnemy = true;
-                    break;
-                }
-            }
-        }
-        
-        if(!hitEnemy)
-        { // move on to the next shot in the player shots container
-            shotIt++;
-        }
+    BUZZY_PROFILE_ZONE("drawScene");
+    window.clear();
+    window.draw(background);
+    std::size_t drawCalls = 1;
+
+    batch.begin();
+    for (const SpriteInstance& sprite : scene.sprites)
+    { // already in draw order: player, enemies, player lasers, enemy lasers
+        batch.add(atlas, sprite.position, sprite.halfExtents, kAtlas[sprite.sprite].rect);
     }
-}
+    drawCalls += batch.flush(window);
 
-/*
- * Purpose:
- *      Detect direct player vs enemy sprite overlap (touch = lose).
- * Input(s):
- *      const ECE_Buzzy& buzzy        - player
- *      vector<ECE_Enemy>& enemies    - swarm
- * Output:
- *      bool - true if any alive enemy intersects the player.
- */
-static bool checkPlayerEnemyCollision(const ECE_Buzzy& buzzy,
-                                     std::vector<ECE_Enemy>& enemies)
-{
-    const FloatRect buzzyBounds = buzzy.getGlobalBounds();
-    
-    for (const auto& enemy : enemies)
-    { // loops through all the enemies in enemies container
-        if(enemy.isAlive() && buzzyBounds.intersects(enemy.getGlobalBounds()))
-        { // return true (player and enemy interection) if they intersect, false otherwise
-            return true;
-        }
+    {
+        BUZZY_PROFILE_ZONE("display");                  // includes any vsync/driver wait
+        window.display();
     }
-    return false;
+    return drawCalls;
 }
 
 /*
  * Purpose:
- *      Detect enemy-shot vs player collision. Erases the colliding shot.
- * Input(s):
- *      list<ECE_LaserBlast>& enemyShots - enemy lasers (mutable; may erase)
- *      const ECE_Buzzy& buzzy           - player
- * Output:
- *      bool - true if the player was hit this frame.
+ *      Running draw-call statistics for one round.
+ * Fields:
+ *      frames         - frames drawn
+ *      drawCalls      - total draw calls over all frames
+ *      maxDrawCalls   - most draw calls in a single frame
  */
-static bool checkEnemyShotCollisions(std::list<ECE_LaserBlast>& enemyShots,
-                                     const ECE_Buzzy& buzzy)
+struct RenderStats
 {
-    const FloatRect buzzyBounds = buzzy.getGlobalBounds();
-    
-    for (auto shotIt = enemyShots.begin(); shotIt != enemyShots.end();)
-    { // loops through all shots in enemy shots container
-        if (buzzyBounds.intersects(shotIt->getGlobalBounds()))
-        { // executes if buzzy intersects the bounds of the current enemy shot
-            enemyShots.erase(shotIt);
-            return true;
-        }
-        else
-        { // moves on to the next shot in the enemy shots container
-            shotIt++;
-        }
-    }
-    return false;
-}
-
+    std::size_t frames       = 0;
+    std::size_t drawCalls    = 0;
+    std::size_t maxDrawCalls = 0;
+};
 
 /*
  * Purpose:
- *      Returns true when all enemies are dead (win condition).
+ *      Prints a one-line draw-call and frame-pacing summary for the round.
  * Input(s):
- *      vector<ECE_Enemy>& enemies - swarm
+ *      const RenderStats& stats      - statistics gathered during the round
+ *      const FramePacingStats& pacing - measured frame intervals
  * Output:
- *      bool - true if no enemy is alive; false otherwise.
+ *      None
  */
-static bool checkWin(std::vector<ECE_Enemy>& enemies)
+static void reportRenderStats(const RenderStats& stats, const FramePacingStats& pacing)
 {
-    for (const auto& enemy : enemies)
-    { // loops through all enemies in enemies container
-        if(enemy.isAlive())
-        { // returns false if any are alive - haven't won yet
-            return false;
-        }
+    if (stats.frames == 0)
+    {
+        return;
     }
-    
-    return true; // returns true if all enemies are killed - win!
+    std::cout << "frames=" << stats.frames
+              << " drawCalls/frame avg=" << static_cast<double>(stats.drawCalls) / stats.frames
+              << " max=" << stats.maxDrawCalls
+              << " frame ms avg=" << pacing.meanMs
+              << " jitter=" << pacing.jitterMs
+              << " maxDev=" << pacing.maxDeviationMs
+              << " late=" << pacing.lateFrames << std::endl;
 }
 
 /*
  * Purpose:
- *      Draw the current frame: background, player, enemies, and lasers.
+ *      Render thread body: draws every published snapshot until the
+ *      exchange is closed.
  * Input(s):
- *      RenderWindow& window                - target window
- *      const Sprite& background            - pre-scaled background
- *      const ECE_Buzzy& buzzy              - player
- *      const vector<ECE_Enemy>& enemies    - swarm
- *      const list<ECE_LaserBlast>& playerShots - player lasers
- *      const list<ECE_LaserBlast>& enemyShots  - enemy lasers
+ *      RenderWindow& window          - window to draw into (released by the
+ *                                      main thread before this starts)
+ *      const Sprite& background      - pre-scaled background
+ *      const Texture& atlas          - sprite atlas
+ *      ECE_SnapshotExchange& scenes  - source of snapshots
+ *      ECE_FramePacer& pacer         - frame limiter (waited on after display)
+ *      RenderStats& stats            - receives draw-call statistics
  * Output:
- *      None (renders to window and displays).
+ *      None
+ * Notes:
+ *      Takes the window's GL context for the duration and gives it back on
+ *      exit, so the main thread can draw the end screens after join().
  */
-static void drawScene(RenderWindow& window,
-                      const Sprite& background,
-                      const ECE_Buzzy& buzzy,
-                      const std::vector<ECE_Enemy>& enemies,
-                      const std::list<ECE_LaserBlast>& playerShots,
-                      const std::list<ECE_LaserBlast>& enemyShots)
+static void renderLoop(RenderWindow& window,
+                       const Sprite& background,
+                       const Texture& atlas,
+                       ECE_SnapshotExchange& scenes,
+                       ECE_FramePacer& pacer,
+                       RenderStats& stats)
 {
-    window.clear();
-    window.draw(background);
-    window.draw(buzzy);
+    window.setActive(true);
+    ECE_SpriteBatch batch;                             // quads, storage reused every frame
 
-    for (const auto& enemy : enemies)
-    { // loops through all enemies in enemies container
-        if (enemy.isAlive())
-        { // draw the enemy if it is alive
-            window.draw(enemy);
-        }
-    }
+    while (const RenderSnapshot* scene = scenes.acquire())
+    {
+        BUZZY_PROFILE_ZONE("renderFrame");
+        const std::size_t drawCalls = drawScene(window, background, *scene, atlas, batch);
+        ++stats.frames;
+        stats.drawCalls   += drawCalls;
+        stats.maxDrawCalls = std::max(stats.maxDrawCalls, drawCalls);
 
-    for (const auto& playerShot : playerShots)
-    { // loops through all player shots and draws them
-        window.draw(playerShot);
-    }
-    
-    for (const auto& enemyShot : enemyShots)
-    { // loops through all enemy shots and draws them
-        window.draw(enemyShot);
+        pacer.wait();                                   // hold the frame rate; measures jitter either way
     }
-
-    window.display();
+    window.setActive(false);
 }
 
 /*
@@ -666,73 +593,137 @@ static void drawScene(RenderWindow& window,
  *      per-round initialization. Returns outcome and whether the user wants
  *      to replay (via end/win screens).
  * Input(s):
- *      RenderWindow& window - active SFML window
- *      const Assets& assets - preloaded textures reused across rounds
+ *      RenderWindow& window      - active SFML window
+ *      const Assets& assets      - textures reused across rounds
+ *      ECE_TextureLoader& loader - source of allTextures; only the start
+ *                                  screen has to be loaded on entry
+ *      ECE_FramePacer& pacer     - gameplay frame limiter, run by the render
+ *                                  thread (stats reset per round)
+ *      ECE_Replay* recorder      - if not null, receives the round's seed and
+ *                                  every tick's input
  * Output:
  *      GameOutcome - Win/Lose/Quit indicating what happened and replay choice.
  */
-GameOutcome playGame(RenderWindow& window, const allTextures& allTextures)
+GameOutcome playGame(RenderWindow& window, const allTextures& allTextures,
+                     ECE_TextureLoader& loader, ECE_FramePacer& pacer, ECE_Replay* recorder)
 {
-    // Build sprites that depend on window size
     Sprite start = makeBackground(allTextures.startTex, window.getSize());
-    Sprite end   = makeBackground(allTextures.endTex,   window.getSize());
-    Sprite win   = makeBackground(allTextures.winTex,   window.getSize());
-    Sprite bg    = makeBackground(allTextures.bgTex,    window.getSize());
-
-    if (!startScreen(window, start))
+    if (!startScreen(window, start, loader))
     {
         return GameOutcome::Quit;
     }
+    loader.finish();                                   // usually already done while the start screen was up
+
+    // Build sprites that depend on window size
+    Sprite end   = makeBackground(allTextures.endTex,   window.getSize());
+    Sprite win   = makeBackground(allTextures.winTex,   window.getSize());
+    Sprite bg    = makeBackground(allTextures.bgTex,    window.getSize());
 
     // --- per-run state ---
-    ECE_Buzzy buzzy(allTextures.buzzyTex);
-    buzzy.scaleForWindow(window.getSize(), 0.10f, 0.10f);
-    buzzy.setPosition(window.getSize().x / 2.f, window.getSize().y * 0.25f);
+    GameConfig config;
+    config.windowSize = window.getSize();
 
-    std::list<ECE_LaserBlast> playerShots, enemyShots; // declare lists to hold player and enemy shots
-    std::vector<ECE_Enemy> enemies;                    // declare vector to hold enemies
-    createEnemies(enemies, allTextures.enemy1Tex, allTextures.enemy2Tex, window.getSize());
+    config.buzzyTexSize  = kAtlas[AtlasBuzzy].sourceSize;      // hitboxes follow the source PNGs,
+    config.laserTexSize  = kAtlas[AtlasLaser].sourceSize;      // not the (possibly downscaled) atlas cells
+    config.enemy1TexSize = kAtlas[AtlasBulldog].sourceSize;
+    config.enemy2TexSize = kAtlas[AtlasTigers].sourceSize;
+    config.seed          = std::random_device{}();             // fresh round each time; recorded for replays
 
-    float enemySpeedX = 300.f;  // enemy speed (pixels per second)
-    int   dir         = +1;     // initial direction is +x (right)
-    float stepUp      = -20.f;  // constant for step up after hitting wall
+    GameState state(config);
+    if (recorder)
+    {
+        recorder->begin(config);
+    }
 
-    Clock clock, enemyShotsClock;           // keep track of enemy shots interval
-    const float enemyShotsInterval = 0.5f;  // shot happens every .5 seconds
+    RenderStats renderStats;
+
+    pacer.restart();                                   // the start screen was a pause, not a frame
+    pacer.resetStats();
+
+    // Drawing and display() run on their own thread, fed one snapshot per
+    // frame, so presentation overlaps the next frame's input and ticks
+    ECE_SnapshotExchange scenes;
+    window.setActive(false);                           // hand the GL context to the render thread
+    std::thread renderer(renderLoop, std::ref(window), std::cref(bg), std::cref(allTextures.atlasTex),
+                         std::ref(scenes), std::ref(pacer), std::ref(renderStats));
+    auto stopRenderer = [&]
+    { // after this the main thread owns the window (and its context) again
+        scenes.close();
+        renderer.join();
+        window.setActive(true);
+    };
+
+    Clock clock;
+    const float tickDt      = 1.f / config.tickRate;   // fixed simulation step (seconds)
+    float       accumulator = 0.f;                     // real time not yet simulated
+    InputFrame  pending;                               // input waiting for the next tick
 
     // --- main run loop ---
-    while (window.isOpen())
+    while (true)
     {
-        handleEvents(window, buzzy, playerShots, allTextures.laserTex);
-
-        if (enemyShotsClock.getElapsedTime().asSeconds() >= enemyShotsInterval)
-            spawnEnemyLaser(enemyShotsClock, enemyShots, enemies, allTextures.laserTex);
-
-        float dt = clock.restart().asSeconds();
+        BUZZY_PROFILE_ZONE("frame");
+        bool quit = false;
+        const InputFrame polled = handleEvents(window, quit);
+        if (quit)
+        { // Esc or the close button
+            stopRenderer();
+            window.close();
+            break;
+        }
+        pending.left  = polled.left;
+        pending.right = polled.right;
+        pending.fire  = pending.fire || polled.fire;    // keep a press until a tick consumes it
+
+        accumulator += std::min(clock.restart().asSeconds(), config.maxFrameTime);
+
+        int steps = 0;
+        while (accumulator >= tickDt && steps < config.maxCatchUpSteps)
+        { // run as many fixed ticks as real time allows
+            const StepResult result = state.step(tickDt, pending);
+            if (recorder)
+            { // record exactly what this tick consumed
+                recorder->record(pending);
+            }
+            pending.fire = false;
+            accumulator -= tickDt;
+            ++steps;
+
+            if (result != StepResult::Running)
+            {
+                stopRenderer();
+                reportRenderStats(renderStats, pacer.stats());
+                if (recorder)
+                {
+                    recorder->finish(result);
+                }
+            }
 
-        updateBuzzy(buzzy, dt, window.getSize().x);
-        updateShots(playerShots, enemyShots, dt, window.getSize().y);
-        updateEnemies(enemies, dt, window.getSize().x, enemySpeedX, dir, stepUp);
+            if (result == StepResult::Lose)
+            {
+                // Ask to replay
+                const bool again = endScreen(window, end);
+                return again ? GameOutcome::Lose : GameOutcome::Quit;
+            }
 
-        checkPlayerShotCollisions(playerShots, enemies);
+            if (result == StepResult::Win)
+            {
+                const bool again = endScreen(window, win);
+                return again ? GameOutcome::Win : GameOutcome::Quit;
+            }
+        }
 
-        const bool killedByShot   = checkEnemyShotCollisions(enemyShots, buzzy);
-        const bool collidedEnemy  = checkPlayerEnemyCollision(buzzy, enemies);
-        if (killedByShot || collidedEnemy)
-        {
-            // Ask to replay
-            const bool again = endScreen(window, end);
-            return again ? GameOutcome::Lose : GameOutcome::Quit;
+        if (accumulator >= tickDt)
+        { // hit the catch-up cap: drop the backlog instead of spiralling
+            accumulator = std::fmod(accumulator, tickDt);
         }
 
-        const bool winNow = checkWin(enemies);
-        if (winNow)
+        RenderSnapshot* scene = nullptr;
         {
-            const bool again = endScreen(window, win);
-            return again ? GameOutcome::Win : GameOutcome::Quit;
+            BUZZY_PROFILE_ZONE("waitForRenderer");     // blocks until the last frame was picked up
+            scene = scenes.beginWrite();
         }
-
-        drawScene(window, bg, buzzy, enemies, playerShots, enemyShots);
+        captureScene(state, accumulator / tickDt, *scene);
+        scenes.publish();
     }
 
     return GameOutcome::Quit; // window closed
@@ -741,35 +732,109 @@ GameOutcome playGame(RenderWindow& window, const allTextures& allTextures)
 
 // --------------------------- main ---------------------------
 
+/*
+ * Purpose:
+ *      Reports a bad command line.
+ * Input(s):
+ *      const std::string& message - what was wrong
+ * Output:
+ *      int - exit code for main (always 1)
+ */
+static int usageError(const std::string& message)
+{
+    std::cerr << "Lab1: " << message << "\n"
+              << "usage: Lab1 [--record <prefix>] [--disk-assets] [--fps N] [--vsync]\n";
+    return 1;
+}
+
 /*
  * Purpose:
  *      Program entry. Creates window, loads assets once, then runs rounds
  *      until the player chooses to quit.
  * Input(s):
- *      None
+ *      argv - optional flags (see Usage in the file header)
  * Output:
- *      int - standard process exit code (0 on normal termination).
+ *      int - standard process exit code (0 on normal termination, 1 on bad
+ *            arguments).
  */
-int main()
+int main(int argc, char** argv)
 {
+    std::string recordPrefix;
+    bool        preferDiskAssets = false;
+    float       fps   = 60.f;
+    bool        vsync = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if ((arg == "--record" || arg == "--fps") && i + 1 >= argc)
+        {
+            return usageError("missing value for " + arg);
+        }
+        if (arg == "--record")
+        {
+            recordPrefix = argv[++i];
+            if (recordPrefix.empty())
+            {
+                return usageError("--record needs a non-empty prefix");
+            }
+        }
+        else if (arg == "--disk-assets")
+        {
+            preferDiskAssets = true;
+        }
+        else if (arg == "--fps")
+        {
+            const char* text = argv[++i];
+            char*       end  = nullptr;
+            fps = std::strtof(text, &end);
+            if (*text == '\0' || *end != '\0' || !(fps >= 0.f))
+            { // NaN fails the comparison too
+                return usageError("--fps must be a number >= 0 (0 = uncapped): " + std::string(text));
+            }
+        }
+        else if (arg == "--vsync")
+        {
+            vsync = true;
+        }
+        else
+        {
+            return usageError("unknown option " + arg);
+        }
+    }
+
     RenderWindow window(VideoMode(1920,1080), "Buzzy_Defender!", Style::Default);
+    window.setVerticalSyncEnabled(vsync);
+    ECE_FramePacer pacer(vsync ? 0.f : fps);            // with vsync the pacer only measures
 
+    // Decode every image in parallel (or map its cached pixels); only the
+    // start screen is waited for, the rest are uploaded while it is showing
     allTextures allTextures;
-    allTextures.startTex.loadFromFile("graphics/Start_Screen.png");
-    allTextures.endTex.loadFromFile("graphics/End_Screen.png");
-    allTextures.winTex.loadFromFile("graphics/Win_Screen.png");
-    allTextures.bgTex.loadFromFile("graphics/background.png");
-    allTextures.buzzyTex.loadFromFile("graphics/Buzzy_blue.png");
-    allTextures.laserTex.loadFromFile("graphics/laser.png");
-    allTextures.enemy1Tex.loadFromFile("graphics/bulldog.png");
-    allTextures.enemy2Tex.loadFromFile("graphics/clemson_tigers.png");
-
+    ECE_TextureLoader loader("texture_cache");
+    const std::size_t startId = requestAsset(loader, "graphics/Start_Screen.png", allTextures.startTex, preferDiskAssets);
+    requestAsset(loader, "graphics/background.png", allTextures.bgTex,    preferDiskAssets);
+    requestAsset(loader, kAtlasFile,                 allTextures.atlasTex, preferDiskAssets);
+    requestAsset(loader, "graphics/End_Screen.png", allTextures.endTex,   preferDiskAssets);
+    requestAsset(loader, "graphics/Win_Screen.png", allTextures.winTex,   preferDiskAssets);
+    loader.waitFor(startId);
+
+    ECE_Replay replay;
+    int round = 0;
     while (window.isOpen())
     {
-        GameOutcome r = playGame(window, allTextures);
+        GameOutcome r = playGame(window, allTextures, loader, pacer, recordPrefix.empty() ? nullptr : &replay);
+        if (!recordPrefix.empty() && replay.tickCount() > 0)
+        { // quit mid-round is saved too (recorded result stays Running)
+            const std::string path = recordPrefix + "_" + std::to_string(++round) + ".bzr";
+            if (replay.saveToFile(path))
+            {
+                std::cout << "replay saved: " << path << " (" << replay.tickCount() << " ticks)" << std::endl;
+            }
+            replay.begin(GameConfig());
+        }
         if (r == GameOutcome::Quit)
             break; // user chose to quit (Esc/close)
         // otherwise loop and start a fresh round
     }
+    BUZZY_PROFILE_REPORT("buzzy_trace.json");
     return 0;
 }
\ No newline at end of file
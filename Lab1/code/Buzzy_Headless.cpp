@@ -0,0 +1,212 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Display-less driver for the GameState core. Plays many rounds back to back
+with a simple scripted bot and reports outcomes and throughput, so gameplay
+can be balanced and regression-checked on machines without a GPU.
+
+Usage: buzzy_headless [rounds=1000] [seed=1] [tickRate=120]
+       buzzy_headless --replay <file.bzr> [repeat=1]
+    --replay  re-runs a recorded round as fast as possible, checks that it
+              ends the same way on the same tick, and reports ticks/s
+
+Built with -DBUZZY_PROFILING=ON, both modes also write buzzy_trace.json and
+print a per-phase timing summary.
+*/
+
+#include <algorithm>           // std::max for pool high-water marks
+#include <chrono>              // std::chrono::steady_clock for throughput timing
+#include <cstdio>              // std::printf for the summary
+#include <cstdlib>             // std::strtol / std::strtof for arguments
+#include <string>              // std::string for argument matching
+
+#include "ECE_LaserKernels.h"  // laserKernelIsa for the summary
+#include "ECE_Profiler.h"      // BUZZY_PROFILE_REPORT for profiling builds
+#include "ECE_Replay.h"        // Recorded rounds for --replay
+#include "ECE_ScriptedBot.h"   // Deterministic stand-in player
+#include "GameState.h"         // Headless simulation core
+
+/*
+ * Purpose:
+ *      Parses a whole string as a decimal integer.
+ * Input(s):
+ *      const char* text - e.g. "1000"
+ *      long& value      - receives the number
+ * Output:
+ *      bool - false if the text is empty or has anything after the digits
+ */
+static bool parseLong(const char* text, long& value)
+{
+    char* end = nullptr;
+    value = std::strtol(text, &end, 10);
+    return *text != '\0' && *end == '\0';
+}
+
+/*
+ * Purpose:
+ *      Reports a bad command line.
+ * Input(s):
+ *      const char* message - what was wrong
+ * Output:
+ *      int - exit code for main (always 1)
+ */
+static int usageError(const char* message)
+{
+    std::fprintf(stderr, "buzzy_headless: %s\n"
+                         "usage: buzzy_headless [rounds=1000] [seed=1] [tickRate=120]\n"
+                         "       buzzy_headless --replay <file.bzr> [repeat=1]\n", message);
+    return 1;
+}
+
+/*
+ * Purpose:
+ *      Plays a recorded round back repeat times at full speed.
+ * Input(s):
+ *      const char* path - replay file
+ *      long repeat      - how many times to run it
+ * Output:
+ *      int - 0 if every run matched the recording, 1 otherwise.
+ */
+static int runReplay(const char* path, long repeat)
+{
+    ECE_Replay replay;
+    if (!replay.loadFromFile(path))
+    {
+        std::fprintf(stderr, "buzzy_headless: cannot read replay %s\n", path);
+        return 1;
+    }
+    const GameConfig config = replay.makeConfig();
+    const float      dt     = 1.f / config.tickRate;
+
+    static const char* const names[] = {"running", "win", "lose"};  // indexed by StepResult
+    long mismatches = 0, totalTicks = 0;
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (long r = 0; r < repeat; ++r)
+    {
+        GameState  state(config);
+        StepResult result = StepResult::Running;
+        InputFrame input;
+        long tick = 0;
+        replay.rewind();
+        while (result == StepResult::Running && replay.next(input))
+        {
+            result = state.step(dt, input);
+            ++tick;
+        }
+        totalTicks += tick;
+
+        if (result != replay.result() || static_cast<std::size_t>(tick) != replay.tickCount())
+        { // simulation diverged from the recording
+            ++mismatches;
+            if (mismatches == 1)
+            {
+                std::printf("mismatch: recorded %s at tick %zu, replayed %s at tick %ld\n",
+                            names[static_cast<int>(replay.result())], replay.tickCount(),
+                            names[static_cast<int>(result)], tick);
+            }
+        }
+    }
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    std::printf("replay=%s seed=%u tickRate=%g ticks=%zu runs=%zu result=%s\n",
+                path, config.seed, config.tickRate, replay.tickCount(), replay.runCount(),
+                names[static_cast<int>(replay.result())]);
+    std::printf("repeat=%ld mismatches=%ld elapsed=%.3fs ticks/s=%.0f\n",
+                repeat, mismatches, secs, totalTicks / secs);
+    BUZZY_PROFILE_REPORT("buzzy_trace.json");
+    return mismatches == 0 ? 0 : 1;
+}
+
+/*
+ * Purpose:
+ *      Program entry. Runs the requested number of rounds and prints a summary.
+ * Input(s):
+ *      argv[1] - number of rounds (default 1000)
+ *      argv[2] - base RNG seed; round r uses seed + r (default 1)
+ *      argv[3] - fixed simulation ticks per second (default GameConfig::tickRate)
+ *      or "--replay <file> [repeat]" (see Usage in the file header)
+ * Output:
+ *      int - 0 on success, 1 on bad arguments or a replay mismatch.
+ */
+int main(int argc, char** argv)
+{
+    if (argc > 1 && std::string(argv[1]) == "--replay")
+    { // always the replay branch, so a forgotten path fails instead of playing 0 rounds
+        long repeat = 1;
+        if (argc < 3 || argc > 4)
+        {
+            return usageError("--replay needs a replay file (and optionally a repeat count)");
+        }
+        if (argc == 4 && (!parseLong(argv[3], repeat) || repeat < 1))
+        {
+            return usageError("repeat must be a whole number >= 1");
+        }
+        return runReplay(argv[2], repeat);
+    }
+    if (argc > 4)
+    {
+        return usageError("too many arguments");
+    }
+
+    long rounds = 1000, seed = 1;
+    if (argc > 1 && (!parseLong(argv[1], rounds) || rounds < 1))
+    {
+        return usageError("rounds must be a whole number >= 1");
+    }
+    if (argc > 2 && !parseLong(argv[2], seed))
+    {
+        return usageError("seed must be a whole number");
+    }
+
+    GameConfig config;
+    if (argc > 3)
+    {
+        char* end = nullptr;
+        config.tickRate = std::strtof(argv[3], &end);
+        if (*argv[3] == '\0' || *end != '\0' || !(config.tickRate > 0.f))
+        {
+            return usageError("tickRate must be a number > 0");
+        }
+    }
+    const float dt       = 1.f / config.tickRate;               // same fixed step as the windowed game
+    const long  maxTicks = static_cast<long>(600.f / dt);      // give up on a round after 10 simulated minutes
+
+    long wins = 0, losses = 0, timeouts = 0, totalTicks = 0;
+    std::size_t shotHighWater = 0, shotsDropped = 0;    // laser pool pressure across all rounds
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (long r = 0; r < rounds; ++r)
+    { // play each round to completion (or timeout)
+        config.seed = static_cast<std::uint32_t>(seed + r);     // distinct but reproducible rounds
+        GameState state(config);
+        StepResult result = StepResult::Running;
+        ECE_ScriptedBot bot;
+        long tick = 0;
+        for (; tick < maxTicks && result == StepResult::Running; ++tick)
+        {
+            result = state.step(dt, bot.next(tick, state));
+        }
+
+        totalTicks += tick;
+        for (const ECE_LaserPool* pool : {&state.playerShots(), &state.enemyShots()})
+        {
+            shotHighWater = std::max(shotHighWater, pool->highWaterMark());
+            shotsDropped += pool->droppedCount();
+        }
+        if (result == StepResult::Win)       { ++wins; }
+        else if (result == StepResult::Lose) { ++losses; }
+        else                                 { ++timeouts; }
+    }
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    std::printf("rounds=%ld wins=%ld losses=%ld timeouts=%ld ticks=%ld\n",
+                rounds, wins, losses, timeouts, totalTicks);
+    std::printf("laser pool high-water=%zu dropped=%zu kernels=%s\n", shotHighWater, shotsDropped, laserKernelIsa());
+    std::printf("elapsed=%.3fs rounds/s=%.1f ticks/s=%.0f\n",
+                secs, rounds / secs, totalTicks / secs);
+    BUZZY_PROFILE_REPORT("buzzy_trace.json");
+    return 0;
+}
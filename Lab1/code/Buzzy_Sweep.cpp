@@ -0,0 +1,339 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Parallel tuning sweep. Plays independent headless matches (scripted bot vs.
+GameState) for every combination of the listed tuning values and every
+seed, spread over all cores with a work-stealing thread pool, and writes one
+CSV row per match. Matches share nothing, so throughput scales with cores;
+rows are written in match order, so the CSV is identical for any thread
+count.
+
+Usage: buzzy_sweep [--seeds N] [--threads T] [--out file.csv]
+                   [--speed v,v,...] [--interval v,...] [--stepUp v,...]
+                   [--grid CxR,...] [--maxSeconds S]
+    --seeds      seeds per parameter combination (default 100)
+    --threads    worker threads, at least 1 (default: one per hardware thread)
+    --out        CSV path (default sweep.csv)
+    --speed      GameConfig::enemySpeedX values, > 0 (default 300)
+    --interval   GameConfig::enemyShotsInterval values, > 0 (default 0.5)
+    --stepUp     GameConfig::stepUp values (default -20)
+    --grid       swarm columns x rows for createEnemies (default 8x4); each grid
+                 must fit the playfield, at most 17x4 at 1920x1080
+    --maxSeconds simulated seconds before a match counts as a timeout (default 600)
+
+Any malformed or out-of-range value prints a usage error and exits with 1.
+The CSV is opened before the first match, so an unwritable --out fails fast.
+
+Built with -DBUZZY_PROFILING=ON, also writes buzzy_trace.json (one track per
+worker) and a per-phase timing summary.
+*/
+
+#include <chrono>              // std::chrono::steady_clock for throughput
+#include <cstdint>             // std::uint32_t for seeds
+#include <cstdio>              // std::printf / std::fprintf / std::FILE for the CSV
+#include <cstdlib>             // std::strtol / std::strtof for arguments
+#include <sstream>             // std::stringstream to split comma lists
+#include <string>              // std::string for arguments
+#include <utility>             // std::pair for grid sizes
+#include <vector>              // std::vector for the parameter grid and results
+
+#include "ECE_Profiler.h"      // BUZZY_PROFILE_REPORT for profiling builds
+#include "ECE_ScriptedBot.h"   // Deterministic stand-in player
+#include "ECE_ThreadPool.h"    // Work-stealing pool
+#include "GameState.h"         // Headless simulation core
+#include "GameSystems.h"       // enemyGridFits to validate --grid
+
+/*
+ * Purpose:
+ *      Outcome and counters of one match.
+ * Fields:
+ *      result       - Win, Lose, or Running (timed out)
+ *      ticks        - ticks simulated
+ *      kills        - enemies destroyed
+ *      playerShots  - player lasers fired
+ *      enemyShots   - enemy lasers fired
+ */
+struct MatchResult
+{
+    StepResult  result      = StepResult::Running;
+    long        ticks       = 0;
+    std::size_t kills       = 0;
+    std::size_t playerShots = 0;
+    std::size_t enemyShots  = 0;
+};
+
+/*
+ * Purpose:
+ *      Parses a whole string as a decimal integer.
+ * Input(s):
+ *      const std::string& text - e.g. "100"
+ *      long& value             - receives the number
+ * Output:
+ *      bool - false if the text is empty or has anything after the digits
+ */
+static bool parseLong(const std::string& text, long& value)
+{
+    char* end = nullptr;
+    value = std::strtol(text.c_str(), &end, 10);
+    return !text.empty() && *end == '\0';
+}
+
+/*
+ * Purpose:
+ *      Parses a whole string as a number.
+ * Input(s):
+ *      const std::string& text - e.g. "0.5"
+ *      float& value            - receives the number
+ * Output:
+ *      bool - false if the text is empty or has anything after the number
+ */
+static bool parseFloat(const std::string& text, float& value)
+{
+    char* end = nullptr;
+    value = std::strtof(text.c_str(), &end);
+    return !text.empty() && *end == '\0';
+}
+
+/*
+ * Purpose:
+ *      Splits a comma-separated list of numbers.
+ * Input(s):
+ *      const std::string& text    - e.g. "200,300,400"
+ *      bool positive              - every value must be > 0
+ *      std::vector<float>& values - receives the parsed values
+ * Output:
+ *      bool - false on an empty list or an entry that is not a number (or
+ *             not positive when required)
+ */
+static bool parseList(const std::string& text, bool positive, std::vector<float>& values)
+{
+    values.clear();
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        float v;
+        if (!parseFloat(item, v) || (positive && !(v > 0.f)))
+        {
+            return false;
+        }
+        values.push_back(v);
+    }
+    return !values.empty();
+}
+
+/*
+ * Purpose:
+ *      Splits a comma-separated list of "CxR" swarm grid sizes.
+ * Input(s):
+ *      const std::string& text                 - e.g. "8x4,10x5"
+ *      std::vector<std::pair<int,int>>& grids  - receives (columns, rows) pairs
+ * Output:
+ *      bool - false on an empty list, a malformed entry, or a size outside
+ *             1x1..100x100 (main also checks each grid fits the playfield)
+ */
+static bool parseGrids(const std::string& text, std::vector<std::pair<int, int>>& grids)
+{
+    grids.clear();
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        const std::size_t x = item.find('x');
+        long cols, rows;
+        if (x == std::string::npos ||
+            !parseLong(item.substr(0, x), cols) || !parseLong(item.substr(x + 1), rows) ||
+            cols < 1 || rows < 1 || cols > 100 || rows > 100)
+        {
+            return false;
+        }
+        grids.emplace_back(static_cast<int>(cols), static_cast<int>(rows));
+    }
+    return !grids.empty();
+}
+
+/*
+ * Purpose:
+ *      Reports a bad command line.
+ * Input(s):
+ *      const std::string& message - what was wrong
+ * Output:
+ *      int - exit code for main (always 1)
+ */
+static int usageError(const std::string& message)
+{
+    std::fprintf(stderr, "buzzy_sweep: %s\n"
+                         "usage: buzzy_sweep [--seeds N] [--threads T] [--out file.csv]\n"
+                         "                   [--speed v,v,...] [--interval v,...] [--stepUp v,...]\n"
+                         "                   [--grid CxR,...] [--maxSeconds S]\n", message.c_str());
+    return 1;
+}
+
+/*
+ * Purpose:
+ *      Plays one match to completion (or timeout) with the scripted bot.
+ * Input(s):
+ *      const GameConfig& config - tuning and seed for this match
+ *      long maxTicks            - timeout in ticks
+ * Output:
+ *      MatchResult - outcome and counters
+ */
+static MatchResult playMatch(const GameConfig& config, long maxTicks)
+{
+    const float dt = 1.f / config.tickRate;
+
+    GameState       state(config);
+    ECE_ScriptedBot bot;
+    MatchResult     match;
+    for (; match.ticks < maxTicks && match.result == StepResult::Running; ++match.ticks)
+    {
+        match.result = state.step(dt, bot.next(match.ticks, state));
+    }
+
+    match.kills       = state.enemies().size() - state.enemies().aliveCount();
+    match.playerShots = state.playerShots().spawnedCount();
+    match.enemyShots  = state.enemyShots().spawnedCount();
+    return match;
+}
+
+/*
+ * Purpose:
+ *      Program entry. Builds the match list, runs it on the pool, writes
+ *      the CSV and prints a throughput summary.
+ * Input(s):
+ *      argv - see Usage in the file header
+ * Output:
+ *      int - 0 on success, 1 on bad arguments or an unwritable CSV.
+ */
+int main(int argc, char** argv)
+{
+    long               seeds      = 100;
+    unsigned int       threads    = 0;
+    std::string        outPath    = "sweep.csv";
+    std::vector<float> speeds     = {GameConfig().enemySpeedX};
+    std::vector<float> intervals  = {GameConfig().enemyShotsInterval};
+    std::vector<float> stepUps    = {GameConfig().stepUp};
+    std::vector<std::pair<int, int>> grids = {{GameConfig().enemyCols, GameConfig().enemyRows}};
+    float              maxSeconds = 600.f;
+
+    for (int i = 1; i < argc; i += 2)
+    { // every option takes exactly one value
+        const std::string flag = argv[i];
+        if (i + 1 >= argc)
+        {
+            return usageError("missing value for " + flag);
+        }
+        const std::string value = argv[i + 1];
+        long whole = 0;
+        bool ok    = true;
+        if (flag == "--seeds")
+        {
+            ok = parseLong(value, whole) && whole > 0;
+            seeds = whole;
+        }
+        else if (flag == "--threads")
+        { // omit the option for one worker per hardware thread
+            ok = parseLong(value, whole) && whole > 0 && whole <= 4096;
+            threads = static_cast<unsigned int>(whole);
+        }
+        else if (flag == "--out")        { ok = !value.empty(); outPath = value; }
+        else if (flag == "--speed")      { ok = parseList(value, true, speeds); }
+        else if (flag == "--interval")   { ok = parseList(value, true, intervals); }
+        else if (flag == "--stepUp")     { ok = parseList(value, false, stepUps); }
+        else if (flag == "--grid")       { ok = parseGrids(value, grids); }
+        else if (flag == "--maxSeconds") { ok = parseFloat(value, maxSeconds) && maxSeconds > 0.f; }
+        else
+        {
+            return usageError("unknown option " + flag);
+        }
+        if (!ok)
+        {
+            return usageError("bad value for " + flag + ": " + value);
+        }
+    }
+
+    for (const auto& grid : grids)
+    { // createEnemies packs large grids closer, but not past touching
+        GameConfig config;
+        config.enemyCols = grid.first;
+        config.enemyRows = grid.second;
+        if (!enemyGridFits(config))
+        {
+            return usageError("grid " + std::to_string(grid.first) + "x" + std::to_string(grid.second) +
+                              " does not fit the " + std::to_string(config.windowSize.x) + "x" +
+                              std::to_string(config.windowSize.y) + " playfield");
+        }
+    }
+
+    std::FILE* csv = std::fopen(outPath.c_str(), "w");  // before any match runs, so a bad path fails fast
+    if (!csv)
+    {
+        std::fprintf(stderr, "buzzy_sweep: cannot write %s\n", outPath.c_str());
+        return 1;
+    }
+
+    // Full cartesian product of the tuning values, times the seeds
+    std::vector<GameConfig> configs;
+    for (const auto& grid : grids)
+    {
+        for (const float speed : speeds)
+        {
+            for (const float interval : intervals)
+            {
+                for (const float stepUp : stepUps)
+                {
+                    for (long s = 0; s < seeds; ++s)
+                    {
+                        GameConfig config;
+                        config.enemyCols          = grid.first;
+                        config.enemyRows          = grid.second;
+                        config.enemySpeedX        = speed;
+                        config.enemyShotsInterval = interval;
+                        config.stepUp             = stepUp;
+                        config.seed               = static_cast<std::uint32_t>(s + 1);
+                        configs.push_back(config);
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<MatchResult> results(configs.size());  // each task writes only its own slot
+    const long maxTicks = static_cast<long>(maxSeconds * GameConfig().tickRate);
+
+    const auto t0 = std::chrono::steady_clock::now();
+    std::size_t workers = 0, steals = 0;
+    {
+        ECE_ThreadPool pool(threads);
+        workers = pool.threadCount();
+        for (std::size_t m = 0; m < configs.size(); ++m)
+        {
+            pool.submit([&configs, &results, m, maxTicks] { results[m] = playMatch(configs[m], maxTicks); });
+        }
+        pool.wait();
+        steals = pool.stealCount();
+    }
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    static const char* const names[] = {"timeout", "win", "lose"};  // indexed by StepResult
+    std::fprintf(csv, "match,seed,enemySpeedX,enemyShotsInterval,stepUp,enemyCols,enemyRows,"
+                      "outcome,ticks,kills,playerShots,enemyShots\n");
+    long totalTicks = 0;
+    for (std::size_t m = 0; m < configs.size(); ++m)
+    {
+        const GameConfig&  c = configs[m];
+        const MatchResult& r = results[m];
+        std::fprintf(csv, "%zu,%u,%g,%g,%g,%d,%d,%s,%ld,%zu,%zu,%zu\n",
+                     m, c.seed, c.enemySpeedX, c.enemyShotsInterval, c.stepUp, c.enemyCols, c.enemyRows,
+                     names[static_cast<int>(r.result)], r.ticks, r.kills, r.playerShots, r.enemyShots);
+        totalTicks += r.ticks;
+    }
+    const bool written = (std::fclose(csv) == 0);
+
+    std::printf("matches=%zu threads=%zu steals=%zu elapsed=%.3fs matches/s=%.1f ticks/s=%.0f -> %s\n",
+                configs.size(), workers, steals, secs, configs.size() / secs, totalTicks / secs, outPath.c_str());
+    BUZZY_PROFILE_REPORT("buzzy_trace.json");
+    return written ? 0 : 1;
+}
@@ -0,0 +1,269 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Regression checks for the headless core, run by CTest (one test per case).
+Each case prints what it checked and exits non-zero on the first failure.
+
+Usage: buzzy_tests replay_roundtrip <file.bzr>
+       buzzy_tests record <file.bzr>
+       buzzy_tests resolver_threads [threads=4]
+    replay_roundtrip  records a bot round, saves and reloads it, and checks
+                      the inputs, header and outcome survive the trip
+    record            writes a bot round for buzzy_headless --replay to check
+    resolver_threads  checks the player-shot resolver kills the same enemies
+                      with one thread and with a pool of the given size
+*/
+
+#include <cstdio>              // std::printf / std::fprintf for results
+#include <cstdlib>             // std::strtol for the thread count
+#include <random>              // std::mt19937 for the resolver stress layout
+#include <string>              // std::string for case names
+#include <vector>              // std::vector for the recorded inputs
+
+#include "ECE_Replay.h"        // Recorded rounds
+#include "ECE_ScriptedBot.h"   // Deterministic stand-in player
+#include "ECE_ShotResolver.h"  // Parallel player-shot resolver
+#include "ECE_ThreadPool.h"    // Worker pool for the resolver
+#include "GameState.h"         // Headless simulation core
+#include "GameSystems.h"       // checkPlayerShotCollisions / broadphaseCellSize
+
+/*
+ * Purpose:
+ *      Reports one failed expectation.
+ * Input(s):
+ *      bool ok          - expectation held
+ *      const char* what - description printed on failure
+ * Output:
+ *      bool - ok
+ */
+static bool check(bool ok, const char* what)
+{
+    if (!ok)
+    {
+        std::fprintf(stderr, "FAILED: %s\n", what);
+    }
+    return ok;
+}
+
+/*
+ * Purpose:
+ *      Plays one round with the scripted bot while recording it.
+ * Input(s):
+ *      const GameConfig& config        - round to play
+ *      ECE_Replay& replay              - receives the recording
+ *      std::vector<InputFrame>* inputs - also receives each tick's input (may be nullptr)
+ * Output:
+ *      StepResult - how the round ended (Running = hit the tick limit)
+ */
+static StepResult recordRound(const GameConfig& config, ECE_Replay& replay, std::vector<InputFrame>* inputs)
+{
+    const float dt       = 1.f / config.tickRate;
+    const long  maxTicks = static_cast<long>(600.f / dt);  // same limit as buzzy_headless
+
+    GameState state(config);
+    ECE_ScriptedBot bot;
+    StepResult result = StepResult::Running;
+    replay.begin(config);
+    for (long tick = 0; tick < maxTicks && result == StepResult::Running; ++tick)
+    {
+        const InputFrame input = bot.next(tick, state);
+        result = state.step(dt, input);
+        replay.record(input);
+        if (inputs)
+        {
+            inputs->push_back(input);
+        }
+    }
+    replay.finish(result);
+    return result;
+}
+
+/*
+ * Purpose:
+ *      Config shared by the replay cases (a fixed seed, not the default).
+ * Input(s):
+ *      None
+ * Output:
+ *      GameConfig - config to record with
+ */
+static GameConfig replayConfig()
+{
+    GameConfig config;
+    config.seed = 77;
+    return config;
+}
+
+/*
+ * Purpose:
+ *      Saves a recorded round, loads it back and compares everything.
+ * Input(s):
+ *      const char* path - scratch file for the recording
+ * Output:
+ *      int - 0 if the loaded replay matches the recording
+ */
+static int testReplayRoundTrip(const char* path)
+{
+    const GameConfig config = replayConfig();
+    ECE_Replay recorded;
+    std::vector<InputFrame> inputs;
+    const StepResult result = recordRound(config, recorded, &inputs);
+    if (!check(recorded.saveToFile(path), "saveToFile"))
+    {
+        return 1;
+    }
+
+    ECE_Replay loaded;
+    if (!check(loaded.loadFromFile(path), "loadFromFile"))
+    {
+        return 1;
+    }
+    bool ok = check(loaded.result() == result, "result survives the round trip");
+    ok = check(loaded.tickCount() == inputs.size(), "tick count survives the round trip") && ok;
+    ok = check(loaded.runCount() == recorded.runCount(), "run count survives the round trip") && ok;
+
+    const GameConfig back = loaded.makeConfig();
+    ok = check(back.seed == config.seed && back.tickRate == config.tickRate &&
+               back.windowSize == config.windowSize &&
+               back.enemyCols == config.enemyCols && back.enemyRows == config.enemyRows,
+               "config survives the round trip") && ok;
+
+    InputFrame input;
+    std::size_t tick = 0;
+    loaded.rewind();
+    for (; loaded.next(input); ++tick)
+    { // every tick's input, in order
+        if (tick >= inputs.size() || input.left != inputs[tick].left ||
+            input.right != inputs[tick].right || input.fire != inputs[tick].fire)
+        {
+            std::fprintf(stderr, "FAILED: input differs at tick %zu\n", tick);
+            return 1;
+        }
+    }
+    ok = check(tick == inputs.size(), "playback stops after the last tick") && ok;
+
+    std::printf("replay_roundtrip: ticks=%zu runs=%zu result=%d\n",
+                loaded.tickCount(), loaded.runCount(), static_cast<int>(loaded.result()));
+    return ok ? 0 : 1;
+}
+
+/*
+ * Purpose:
+ *      Writes a recorded bot round for buzzy_headless --replay to verify.
+ * Input(s):
+ *      const char* path - output file
+ * Output:
+ *      int - 0 if the round finished and was saved
+ */
+static int testRecord(const char* path)
+{
+    ECE_Replay replay;
+    const StepResult result = recordRound(replayConfig(), replay, nullptr);
+    if (!check(result != StepResult::Running, "bot round finishes") ||
+        !check(replay.saveToFile(path), "saveToFile"))
+    {
+        return 1;
+    }
+    std::printf("record: %s ticks=%zu result=%d\n", path, replay.tickCount(), static_cast<int>(result));
+    return 0;
+}
+
+/*
+ * Purpose:
+ *      Resolves the same dense shot field with and without a pool and
+ *      checks the kills, survivors and shot layout are identical.
+ * Input(s):
+ *      unsigned int threads - pool size for the parallel run
+ * Output:
+ *      int - 0 if every trial matched
+ */
+static int testResolverThreads(unsigned int threads)
+{
+    const GameConfig config;
+    ECE_EnemySwarm formation;                   // 100 x 100 grid, dense enough to contend for claims
+    for (std::size_t row = 0; row < 100; ++row)
+    {
+        for (std::size_t col = 0; col < 100; ++col)
+        {
+            formation.add({10.f + col * 19.f, 10.f + row * 10.f}, {12.f, 8.f}, EnemyTexture(0), col);
+        }
+    }
+    ECE_UniformGrid grid;
+    grid.configure(broadphaseCellSize(formation), config.windowSize);
+
+    ECE_ThreadPool   pool(threads);
+    ECE_ShotResolver resolver;
+    const std::size_t shotCount = 20000;        // well above the resolver's parallel threshold
+    bool ok = true;
+    for (unsigned int trial = 0; trial < 5; ++trial)
+    {
+        std::mt19937 rng(trial);
+        std::uniform_real_distribution<float> x(0.f, static_cast<float>(config.windowSize.x));
+        std::uniform_real_distribution<float> y(0.f, static_cast<float>(config.windowSize.y));
+        ECE_LaserPool serialShots(shotCount, {3.f, 9.f}), pooledShots(shotCount, {3.f, 9.f});
+        for (std::size_t s = 0; s < shotCount; ++s)
+        {
+            const Vector2f position{x(rng), y(rng)};
+            serialShots.spawn(position, {0.f, 400.f});
+            pooledShots.spawn(position, {0.f, 400.f});
+        }
+        serialShots.update(0.05f);              // long step so swept boxes cover several enemies
+        pooledShots.update(0.05f);
+
+        ECE_EnemySwarm serial = formation, pooled = formation;
+        grid.build(serial);
+        checkPlayerShotCollisions(serialShots, serial, grid, resolver, nullptr);
+        const std::size_t serialHits = resolver.hitCount();
+        checkPlayerShotCollisions(pooledShots, pooled, grid, resolver, &pool);
+
+        bool same = resolver.hitCount() == serialHits &&
+                    serial.aliveCount() == pooled.aliveCount() &&
+                    serialShots.size() == pooledShots.size();
+        for (std::size_t i = 0; same && i < serial.size(); ++i)
+        {
+            same = serial.isAlive(i) == pooled.isAlive(i);
+        }
+        for (std::size_t k = 0; same && k < serial.aliveCount(); ++k)
+        {
+            same = serial.aliveAt(k) == pooled.aliveAt(k);
+        }
+        for (std::size_t s = 0; same && s < serialShots.size(); ++s)
+        {
+            same = serialShots.getPosition(s) == pooledShots.getPosition(s);
+        }
+        ok = check(same, "pooled resolve matches the single-thread resolve") && ok;
+        std::printf("resolver_threads: trial=%u threads=%u hits=%zu alive=%zu shots=%zu\n",
+                    trial, threads, serialHits, serial.aliveCount(), serialShots.size());
+    }
+    return ok ? 0 : 1;
+}
+
+/*
+ * Purpose:
+ *      Program entry. Runs the case named by argv[1].
+ * Input(s):
+ *      argv[1] - case name, argv[2] - its argument (see Usage in the file header)
+ * Output:
+ *      int - 0 if the case passed, 1 on failure or bad arguments.
+ */
+int main(int argc, char** argv)
+{
+    const std::string name = (argc > 1) ? argv[1] : "";
+    if (name == "replay_roundtrip" && argc == 3)
+    {
+        return testReplayRoundTrip(argv[2]);
+    }
+    if (name == "record" && argc == 3)
+    {
+        return testRecord(argv[2]);
+    }
+    if (name == "resolver_threads" && argc <= 3)
+    {
+        const long threads = (argc == 3) ? std::strtol(argv[2], nullptr, 10) : 4;
+        return testResolverThreads(threads > 1 ? static_cast<unsigned int>(threads) : 2u);
+    }
+    std::fprintf(stderr, "usage: buzzy_tests replay_roundtrip <file.bzr> | record <file.bzr> | "
+                         "resolver_threads [threads=4]\n");
+    return 1;
+}
@@ -1,79 +1,97 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_Buzzy class. Movement and the edge clamp
+work directly on the transform and hitbox components.
+*/
+
 #include "ECE_Buzzy.h"
-#include <SFML/Graphics.hpp>
 #include <algorithm>    // for std::clamp
 
 using namespace sf;
 
 /*
  * Purpose:
- *      Constructs a Buzzy player sprite and initializes its base sf::Sprite
- *      with the provided texture so it can be drawn on the screen.
+ *      Constructs the player with a hitbox of the given size, at (0,0).
  * Input(s):
- *      const Texture& texture – read-only reference to the texture image
- *                                representing the player character.
+ *      Vector2f halfExtents - half width/height of the hitbox in pixels
  * Output:
  *      None (constructor).
- * Notes:
- *      Uses 'explicit' to prevent unintended implicit conversions when
- *      passing a Texture to the constructor.
  */
-ECE_Buzzy::ECE_Buzzy(const Texture& texture) // uses scope resolution operator "::" - only this constructor belogns to class ECE_Buzzy
-                                                 // constructor that uses a reference to a texture - does NOT change
-: Sprite(texture)   // call base-class constructor
-                    // When creating an ECE_Buzzy, first construct its Sprite part, passing it the texture so the sprite is ready to display that image
+ECE_Buzzy::ECE_Buzzy(Vector2f halfExtents)
 {
-
-    // scale/center
-    setOrigin(getLocalBounds().width / 2.f,   // Sprite's texture width in pixels
-              getLocalBounds().height / 2.f); // Sprite's texture height in pixels
-              
-    auto b = getLocalBounds();
-    
-    // Scale so that the sprite fits roughly inside 100x100 pixels
-    float scaleX = 100.f / b.width;
-    float scaleY = 100.f / b.height;
-    setScale(scaleX, scaleY);
+    m_collider.halfExtents = halfExtents;
+    refreshBounds(m_transform, m_collider);
 }
 
 /*
  * Purpose:
- *      Scales the Buzzy sprite so it fits within a target fraction of the window size.
+ *      Places Buzzy (center) without touching the previous position.
  * Input(s):
- *      const sf::Vector2u& windowSize - current window dimensions in pixels
- *      float boxFracW - fraction of the window width to occupy (default 0.1f)
- *      float boxFracH - fraction of the window height to occupy (default 0.1f)
+ *      Vector2f position - center in pixels
  * Output:
  *      None
  */
-void ECE_Buzzy::scaleForWindow(const Vector2u& windowSize,
-                               float boxFracW,
-                               float boxFracH)
+void ECE_Buzzy::setPosition(Vector2f position)
 {
-    const auto b = getLocalBounds();
-                                                                                // target box in pixels (fraction of window size)
-    const float targetW = windowSize.x * boxFracW;
-    const float targetH = windowSize.y * boxFracH;
-                                                                                // uniform scale so the sprite fits inside the target box
-    const float sx = targetW / b.width;
-    const float sy = targetH / b.height;
-    const float s  = std::min(sx, sy);                                          // make texture a square & choose minumum of width vs height
-
-    setScale(s, s);
+    m_transform.position = position;
+    refreshBounds(m_transform, m_collider);
 }
 
 /*
  * Purpose:
- *      Sets the horizontal movement speed of the Buzzy sprite.
+ *      Current center position.
+ * Input(s):
+ *      None
+ * Output:
+ *      Vector2f - position in pixels
+ */
+Vector2f ECE_Buzzy::getPosition() const
+    {
+        return m_transform.position;
+    }
+
+/*
+ * Purpose:
+ *      Half width/height of the hitbox.
+ * Input(s):
+ *      None
+ * Output:
+ *      Vector2f - half-extents in pixels
+ */
+Vector2f ECE_Buzzy::getHalfExtents() const
+    {
+        return m_collider.halfExtents;
+    }
+
+/*
+ * Purpose:
+ *      World-space hitbox, cached whenever Buzzy moves.
+ * Input(s):
+ *      None
+ * Output:
+ *      FloatRect - bounds in pixels
+ */
+FloatRect ECE_Buzzy::getBounds() const
+    {
+        return m_collider.bounds;
+    }
+
+/*
+ * Purpose:
+ *      Sets the horizontal movement speed of Buzzy.
  * Input(s):
  *      float s - speed in pixels per second
  * Output:
  *      None
  */
 void ECE_Buzzy::setSpeed(float s)
-    { 
+    {
         m_speed = s;
     }
-    
+
 /*
  * Purpose:
  *      Retrieves the current horizontal movement speed.
@@ -89,29 +107,61 @@ float ECE_Buzzy::getSpeed() const
 
 /*
  * Purpose:
- *      Updates Buzzy's position based on keyboard input and elapsed time.
+ *      Updates Buzzy's position based on player input and elapsed time.
  * Input(s):
  *      float dt - time elapsed since last update (seconds)
  *      float windowWidth - width of the game window (pixels)
+ *      bool left - move-left held
+ *      bool right - move-right held
  * Output:
  *      None
  */
-void ECE_Buzzy::update(float dt, float windowWidth)
+void ECE_Buzzy::update(float dt, float windowWidth, bool left, bool right)
 {
     float dx = 0.f;
-    if (Keyboard::isKeyPressed(Keyboard::Left))
+    if (left)
     {
         dx -= m_speed * dt; // pixels/sec * sec = # pixels to move (-x = left)
     }
-    if (Keyboard::isKeyPressed(Keyboard::Right))
+    if (right)
     {
         dx += m_speed * dt; // pixels/sec * sec = # pixels to move (+x = right)
     }
 
-    Vector2f pos = getPosition(); // 2D vector                      // clamp(value, min, max) restricts value to stay between min & max
-    pos.x = std::clamp(pos.x + dx,                                      // pos.x + dx - new horizontal position after movement
-                        getGlobalBounds().width / 2.f,                  // getGlobalBounds: returns current bounding rectangle of a Sprite in global coordinates
-                                                                        // keep left half of sprite on screen
-                        windowWidth - getGlobalBounds().width / 2.f);   // keep right half of sprite on screen
-    setPosition(pos); // update Sprite's position
-}
\ No newline at end of file
+    const float halfW = m_collider.halfExtents.x;                      // clamp(value, min, max) restricts value to stay between min & max
+    const float x = std::clamp(m_transform.position.x + dx,            // new horizontal position after movement
+                               halfW,                                   // keep left half of Buzzy on screen
+                               windowWidth - halfW);                    // keep right half of Buzzy on screen
+    if (x != m_transform.position.x)
+    { // only a real move invalidates the cached hitbox
+        m_transform.position.x = x;
+        refreshBounds(m_transform, m_collider);
+    }
+}
+
+/*
+ * Purpose:
+ *      Remembers the current position as the start of the next simulation
+ *      tick, so the renderer can interpolate between ticks.
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_Buzzy::savePreviousPosition()
+    {
+        m_transform.previous = m_transform.position;
+    }
+
+/*
+ * Purpose:
+ *      Position at the start of the most recent simulation tick.
+ * Input(s):
+ *      None
+ * Output:
+ *      Vector2f - previous position in pixels
+ */
+Vector2f ECE_Buzzy::getPreviousPosition() const
+    {
+        return m_transform.previous;
+    }
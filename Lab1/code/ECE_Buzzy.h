@@ -1,61 +1,86 @@
 /*
 Author: Liam Long
-Class: ECE4122 
-Last Date Modified: 9/22/25
+Class: ECE4122
+Last Date Modified: 10/16/26
 Description:
-ECE_Buzzy class. Represents the player-controlled character ("Buzzy") as a
-sprite. Inherits from Sprite to gain position, drawing, and transformation
-methods. Includes functions for scaling to the window size, setting and
-retrieving movement speed, and updating position based on keyboard input.
+ECE_Buzzy class. Represents the player-controlled character ("Buzzy") as
+plain component data: a transform (position plus the previous tick's
+position for interpolation), a centered hitbox, and a movement speed. It is
+not an sf::Sprite; the front end draws it from the sprite atlas using the
+position and hitbox, so the simulation never builds graphics objects.
 */
 
-#include <SFML/Graphics.hpp>    // Provides the sf::Sprite, sf::Texture, and related graphics classes
+#pragma once
+
+#include "ECE_Components.h"     // TransformComponent, ColliderComponent, refreshBounds
 
 //using namespace for readability
 using namespace sf;
 
-class ECE_Buzzy : public Sprite                 // Define new class named ECE_Buzzy that inherits from base class Sprite from SFML
+class ECE_Buzzy
 {
 public:
     /*
      * Purpose:
-     *      Constructs a Buzzy player sprite and initializes its base sf::Sprite
-     *      with the provided texture so it can be drawn on the screen.
+     *      Constructs the player with a hitbox of the given size, at (0,0).
      * Input(s):
-     *      const Texture& texture – read-only reference to the texture image
-     *                                representing the player character.
+     *      Vector2f halfExtents - half width/height of the hitbox in pixels
      * Output:
      *      None (constructor).
-     * Notes:
-     *      Uses 'explicit' to prevent unintended implicit conversions when
-     *      passing a Texture to the constructor.
      */
-    explicit ECE_Buzzy(const Texture& texture); // Constructor declaration, texture can't be changed, and must be of form: ECE_Buzzy buzzy(tex);
-    
+    explicit ECE_Buzzy(Vector2f halfExtents);
+
+    /*
+     * Purpose:
+     *      Places Buzzy (center) without touching the previous position.
+     * Input(s):
+     *      Vector2f position - center in pixels
+     * Output:
+     *      None
+     */
+    void setPosition(Vector2f position);
+
+    /*
+     * Purpose:
+     *      Current center position.
+     * Input(s):
+     *      None
+     * Output:
+     *      Vector2f - position in pixels
+     */
+    Vector2f getPosition() const;
+
     /*
      * Purpose:
-     *      Scales the Buzzy sprite so it fits within a target fraction of the window size.
+     *      Half width/height of the hitbox.
      * Input(s):
-     *      const sf::Vector2u& windowSize - current window dimensions in pixels
-     *      float boxFracW - fraction of the window width to occupy (default 0.1f)
-     *      float boxFracH - fraction of the window height to occupy (default 0.1f)
+     *      None
      * Output:
+     *      Vector2f - half-extents in pixels
+     */
+    Vector2f getHalfExtents() const;
+
+    /*
+     * Purpose:
+     *      World-space hitbox (what getGlobalBounds gave for the sprite),
+     *      cached whenever Buzzy moves.
+     * Input(s):
      *      None
+     * Output:
+     *      FloatRect - bounds in pixels
      */
-    void scaleForWindow(const sf::Vector2u& windowSize,                         // allow scaling to match window size
-                        float boxFracW = 0.1f,                                  // width of buzzy texture is 10% of screen width
-                        float boxFracH = 0.1f);                                 // width of buzzy texture is 10% of screen height
-    
+    FloatRect getBounds() const;
+
     /*
      * Purpose:
-     *      Sets the horizontal movement speed of the Buzzy sprite.
+     *      Sets the horizontal movement speed of Buzzy.
      * Input(s):
      *      float s - speed in pixels per second
      * Output:
      *      None
      */
     void setSpeed(float s);
-    
+
     /*
      * Purpose:
      *      Retrieves the current horizontal movement speed.
@@ -68,15 +93,40 @@ public:
 
     /*
      * Purpose:
-     *      Updates Buzzy's position based on keyboard input and elapsed time.
+     *      Updates Buzzy's position based on player input and elapsed time.
      * Input(s):
      *      float dt - time elapsed since last update (seconds)
      *      float windowWidth - width of the game window (pixels)
+     *      bool left - move-left held
+     *      bool right - move-right held
+     * Output:
+     *      None
+     */
+    void update(float dt, float windowWidth, bool left, bool right);
+
+    /*
+     * Purpose:
+     *      Remembers the current position as the start of the next simulation
+     *      tick, so the renderer can interpolate between ticks.
+     * Input(s):
+     *      None
      * Output:
      *      None
      */
-    void update(float dt, float windowWidth);
+    void savePreviousPosition();
+
+    /*
+     * Purpose:
+     *      Position at the start of the most recent simulation tick.
+     * Input(s):
+     *      None
+     * Output:
+     *      Vector2f - previous position in pixels
+     */
+    Vector2f getPreviousPosition() const;
 
 private:
+    TransformComponent m_transform;   // center now / at the start of the tick
+    ColliderComponent  m_collider;    // centered hitbox and its cached world box
     float m_speed = 450.f; // Horizonal speed in pixels per second
-};
\ No newline at end of file
+};
@@ -0,0 +1,180 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Plain-data components shared by the simulation's entity stores. Entities
+are not sf::Sprites: the player (ECE_Buzzy) holds one of each component,
+and the enemy swarm and laser pools keep the same data as contiguous
+per-component arrays. Nothing here depends on SFML graphics objects; only
+the header-only vector and rectangle templates are used. The collision
+helpers here are the only shape math the game uses: centered boxes, and the
+same boxes swept over one tick of straight-line motion.
+
+Entity store      transform      collider        velocity       faction / render
+ECE_Buzzy         members        member + box    speed + input  player / Buzzy sprite
+ECE_EnemySwarm    m_x/m_y/prev   half + m_box*   formation move enemy / EnemyTexture per entry
+ECE_LaserPool     m_x/m_y/prev   one per pool    m_vx/m_vy      one pool per faction / laser sprite
+*/
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>   // sf::FloatRect (header-only template)
+#include <SFML/System/Vector2.hpp>  // sf::Vector2f / sf::Vector2u (header-only templates)
+
+// using namespace for readability
+using namespace sf;
+
+/*
+ * Purpose:
+ *      Where an entity is: center now and at the start of the current tick
+ *      (the renderer interpolates between the two).
+ */
+struct TransformComponent
+{
+    Vector2f position{0.f, 0.f};
+    Vector2f previous{0.f, 0.f};
+};
+
+/*
+ * Purpose:
+ *      Axis-aligned hitbox centered on the entity's position, plus its
+ *      world-space box cached from the last transform change.
+ */
+struct ColliderComponent
+{
+    Vector2f  halfExtents{0.f, 0.f};
+    FloatRect bounds;                   // refreshed by refreshBounds, read by collision code
+};
+
+/*
+ * Purpose:
+ *      World-space box of a centered hitbox (the one collision shape the
+ *      game uses; every store builds its bounds through this).
+ * Input(s):
+ *      float x, float y         - center in pixels
+ *      float halfW, float halfH - half width/height in pixels
+ * Output:
+ *      FloatRect - bounds in pixels
+ */
+inline FloatRect centeredBounds(float x, float y, float halfW, float halfH)
+{
+    return FloatRect(x - halfW, y - halfH, 2.f * halfW, 2.f * halfH);
+}
+
+/*
+ * Purpose:
+ *      Re-caches a collider's world box after its transform moved or its
+ *      half-extents changed.
+ * Input(s):
+ *      const TransformComponent& transform - current center
+ *      ColliderComponent& collider         - hitbox whose cache is refreshed
+ * Output:
+ *      None
+ */
+inline void refreshBounds(const TransformComponent& transform, ColliderComponent& collider)
+{
+    collider.bounds = centeredBounds(transform.position.x, transform.position.y,
+                                     collider.halfExtents.x, collider.halfExtents.y);
+}
+
+/*
+ * Purpose:
+ *      Box covering a centered hitbox over a whole tick of straight-line
+ *      motion (the union of its start and end boxes).
+ * Input(s):
+ *      Vector2f from - center at the start of the tick
+ *      Vector2f to   - center at the end of the tick
+ *      Vector2f half - half width/height in pixels
+ * Output:
+ *      FloatRect - swept bounds in pixels
+ */
+inline FloatRect sweptBounds(Vector2f from, Vector2f to, Vector2f half)
+{
+    const float minX = (from.x < to.x) ? from.x : to.x;
+    const float minY = (from.y < to.y) ? from.y : to.y;
+    const float spanX = (from.x < to.x) ? to.x - from.x : from.x - to.x;
+    const float spanY = (from.y < to.y) ? to.y - from.y : from.y - to.y;
+    return FloatRect(minX - half.x, minY - half.y, spanX + 2.f * half.x, spanY + 2.f * half.y);
+}
+
+/*
+ * Purpose:
+ *      Narrows the overlap interval [tEnter, tExit] of a relative sweep along
+ *      one axis (slab test).
+ * Input(s):
+ *      float p       - start offset between the centers on this axis
+ *      float d       - relative displacement over the tick on this axis
+ *      float h       - summed half-extents on this axis
+ *      float& tEnter - latest entry time so far (updated)
+ *      float& tExit  - earliest exit time so far (updated)
+ * Output:
+ *      bool - false if the boxes never overlap on this axis
+ */
+inline bool sweepSlab(float p, float d, float h, float& tEnter, float& tExit)
+{
+    if (d == 0.f)
+    { // no relative motion: overlapping on this axis for the whole tick, or never
+        return p > -h && p < h;
+    }
+    float t0 = (-h - p) / d;
+    float t1 = ( h - p) / d;
+    if (t0 > t1)
+    {
+        const float t = t0; t0 = t1; t1 = t;
+    }
+    tEnter = (t0 > tEnter) ? t0 : tEnter;
+    tExit  = (t1 < tExit)  ? t1 : tExit;
+    return true;
+}
+
+/*
+ * Purpose:
+ *      Continuous (swept) AABB test: do two centered hitboxes overlap at any
+ *      moment of a tick in which both move in a straight line?
+ * Input(s):
+ *      Vector2f aFrom, aTo, aHalf - first box: start/end center, half-extents
+ *      Vector2f bFrom, bTo, bHalf - second box: start/end center, half-extents
+ *      float& toi                 - receives the time of first contact in
+ *                                   [0, 1] (0 = already overlapping)
+ * Output:
+ *      bool - true if the boxes overlap at some time during the tick
+ * Notes:
+ *      Works in b's frame: a moves by the difference of the displacements
+ *      against b expanded by a's half-extents. Touching edges do not count,
+ *      matching FloatRect::intersects, so a pair that overlaps at the end of
+ *      the tick is always reported.
+ */
+inline bool sweptOverlap(Vector2f aFrom, Vector2f aTo, Vector2f aHalf,
+                         Vector2f bFrom, Vector2f bTo, Vector2f bHalf,
+                         float& toi)
+{
+    float tEnter = 0.f;
+    float tExit  = 1.f;
+    if (!sweepSlab(aFrom.x - bFrom.x, (aTo.x - aFrom.x) - (bTo.x - bFrom.x), aHalf.x + bHalf.x, tEnter, tExit) ||
+        !sweepSlab(aFrom.y - bFrom.y, (aTo.y - aFrom.y) - (bTo.y - bFrom.y), aHalf.y + bHalf.y, tEnter, tExit) ||
+        !(tEnter < tExit))
+    {
+        return false;
+    }
+    toi = tEnter;
+    return true;
+}
+
+/*
+ * Purpose:
+ *      Half-extents of a texture scaled uniformly to fit a target box, i.e.
+ *      the size a centered sprite would have had after setScale(s, s).
+ * Input(s):
+ *      Vector2u texSize - texture size in pixels
+ *      Vector2f box     - target width/height in pixels
+ * Output:
+ *      Vector2f - half width/height in pixels
+ */
+inline Vector2f fitHalfExtents(Vector2u texSize, Vector2f box)
+{
+    const float sx = box.x / texSize.x;
+    const float sy = box.y / texSize.y;
+    const float s  = (sx < sy) ? sx : sy;               // keep aspect ratio: the tighter axis wins
+    return {texSize.x * s / 2.f, texSize.y * s / 2.f};
+}
@@ -0,0 +1,30 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Lookup over the generated embedded-asset table. A handful of entries, so a
+linear scan is all it needs.
+*/
+
+#include "ECE_EmbeddedAssets.h" // EmbeddedAsset table and lookup declaration
+
+/*
+ * Purpose:
+ *      Looks up an embedded file by its on-disk relative path.
+ * Input(s):
+ *      const std::string& path - e.g. "graphics/background.png"
+ * Output:
+ *      const EmbeddedAsset* - the asset, or nullptr if it was not embedded
+ */
+const EmbeddedAsset* findEmbeddedAsset(const std::string& path)
+{
+    for (std::size_t i = 0; i < kEmbeddedAssetCount; ++i)
+    {
+        if (path == kEmbeddedAssets[i].path)
+        {
+            return &kEmbeddedAssets[i];
+        }
+    }
+    return nullptr;
+}
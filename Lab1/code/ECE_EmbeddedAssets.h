@@ -0,0 +1,43 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the assets compiled into the executable. The table itself is
+generated at build time by asset_embedder (ECE_EmbeddedAssetData.cpp) from
+the files listed in CMakeLists.txt; it is empty when BUZZY_EMBED_ASSETS is
+OFF, and every lookup then misses so callers fall back to the disk.
+*/
+
+#pragma once
+
+#include <cstddef>              // std::size_t for asset sizes
+#include <string>               // std::string for lookup keys
+
+/*
+ * Purpose:
+ *      One embedded file.
+ * Fields:
+ *      path - relative path the file would have on disk (lookup key)
+ *      data - file contents, 16-byte aligned
+ *      size - length of data in bytes
+ */
+struct EmbeddedAsset
+{
+    const char*          path;
+    const unsigned char* data;
+    std::size_t          size;
+};
+
+extern const EmbeddedAsset kEmbeddedAssets[];       // kEmbeddedAssetCount entries, then a null sentinel
+extern const std::size_t   kEmbeddedAssetCount;
+
+/*
+ * Purpose:
+ *      Looks up an embedded file by its on-disk relative path.
+ * Input(s):
+ *      const std::string& path - e.g. "graphics/background.png"
+ * Output:
+ *      const EmbeddedAsset* - the asset, or nullptr if it was not embedded
+ */
+const EmbeddedAsset* findEmbeddedAsset(const std::string& path);
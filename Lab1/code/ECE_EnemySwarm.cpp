@@ -0,0 +1,434 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_EnemySwarm class. The bulk operations (move,
+previous-position copy) are plain index loops over contiguous float arrays so
+the compiler can vectorize them. The formation extent is kept as the pair of
+enemies defining its left and right edges; since every enemy moves by the
+same offset, those indices stay correct across move() and only need
+refreshing when one of them is killed.
+*/
+
+#include "ECE_EnemySwarm.h"     // Class declaration and interface
+#include "ECE_Components.h"     // centeredBounds / sweptBounds for the hitbox rectangles
+#include <cassert>              // assert for kill() on a dead enemy
+#include <limits>               // std::numeric_limits for ±infinity bounds
+
+/*
+ * Purpose:
+ *      Removes every enemy.
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_EnemySwarm::clear()
+{
+    m_x.clear();     m_y.clear();
+    m_prevX.clear(); m_prevY.clear();
+    m_halfW.clear(); m_halfH.clear();
+    m_boxLeft.clear(); m_boxTop.clear();
+    m_boxW.clear(); m_boxH.clear();
+    m_alive.clear(); m_texture.clear();
+    m_column.clear();
+    m_colMembers.clear();
+    m_colAlive.clear();
+    m_colLeft.clear(); m_colRight.clear();
+    m_aliveList.clear(); m_alivePos.clear();
+    m_left = m_right = npos;
+}
+
+/*
+ * Purpose:
+ *      Pre-allocates storage for n enemies.
+ * Input(s):
+ *      std::size_t n - expected number of enemies
+ * Output:
+ *      None
+ */
+void ECE_EnemySwarm::reserve(std::size_t n)
+{
+    m_x.reserve(n);     m_y.reserve(n);
+    m_prevX.reserve(n); m_prevY.reserve(n);
+    m_halfW.reserve(n); m_halfH.reserve(n);
+    m_boxLeft.reserve(n); m_boxTop.reserve(n);
+    m_boxW.reserve(n); m_boxH.reserve(n);
+    m_alive.reserve(n); m_texture.reserve(n);
+    m_column.reserve(n);
+    m_aliveList.reserve(n); m_alivePos.reserve(n);
+}
+
+/*
+ * Purpose:
+ *      Appends a live enemy.
+ * Input(s):
+ *      Vector2f position     - center of the enemy in pixels
+ *      Vector2f halfExtents  - half width/height of its bounds in pixels
+ *      EnemyTexture texture  - texture id used when drawing
+ *      std::size_t column    - formation column the enemy belongs to
+ * Output:
+ *      std::size_t - index of the new enemy
+ */
+std::size_t ECE_EnemySwarm::add(Vector2f position, Vector2f halfExtents, EnemyTexture texture, std::size_t column)
+{
+    m_x.push_back(position.x);
+    m_y.push_back(position.y);
+    m_prevX.push_back(position.x);      // no interpolation from the origin on the first frame
+    m_prevY.push_back(position.y);
+    m_halfW.push_back(halfExtents.x);
+    m_halfH.push_back(halfExtents.y);
+    const FloatRect box = centeredBounds(position.x, position.y, halfExtents.x, halfExtents.y);
+    m_boxLeft.push_back(box.left);
+    m_boxTop.push_back(box.top);
+    m_boxW.push_back(box.width);
+    m_boxH.push_back(box.height);
+    m_alive.push_back(1);
+    m_texture.push_back(texture);
+    m_column.push_back(static_cast<std::uint32_t>(column));
+
+    const std::size_t i = m_x.size() - 1;
+    if (column >= m_colMembers.size())
+    { // first enemy in a new column
+        m_colMembers.resize(column + 1);
+        m_colAlive.resize(column + 1, 0);
+        m_colLeft.resize(column + 1, npos);
+        m_colRight.resize(column + 1, npos);
+    }
+    m_colMembers[column].push_back(static_cast<std::uint32_t>(i));
+    ++m_colAlive[column];
+    m_alivePos.push_back(static_cast<std::uint32_t>(m_aliveList.size()));
+    m_aliveList.push_back(static_cast<std::uint32_t>(i));
+
+    // Widen the column and formation edges if the new enemy sticks out further
+    if (m_colLeft[column] == npos || leftEdge(i) < leftEdge(m_colLeft[column]))
+    {
+        m_colLeft[column] = i;
+    }
+    if (m_colRight[column] == npos || rightEdge(i) > rightEdge(m_colRight[column]))
+    {
+        m_colRight[column] = i;
+    }
+    if (m_left == npos || leftEdge(i) < leftEdge(m_left))
+    {
+        m_left = i;
+    }
+    if (m_right == npos || rightEdge(i) > rightEdge(m_right))
+    {
+        m_right = i;
+    }
+    return i;
+}
+
+/*
+ * Purpose:
+ *      Number of enemies stored (alive or dead).
+ * Input(s):
+ *      None
+ * Output:
+ *      std::size_t - entry count
+ */
+std::size_t ECE_EnemySwarm::size() const
+{
+    return m_x.size();
+}
+
+/*
+ * Purpose:
+ *      Checks whether enemy i is still alive.
+ * Input(s):
+ *      std::size_t i - enemy index
+ * Output:
+ *      bool - true if alive
+ */
+bool ECE_EnemySwarm::isAlive(std::size_t i) const
+{
+    return m_alive[i] != 0;
+}
+
+/*
+ * Purpose:
+ *      Marks enemy i as dead and updates its column's alive count and the
+ *      formation edges.
+ * Input(s):
+ *      std::size_t i - enemy index (must be alive)
+ * Output:
+ *      None
+ * Notes:
+ *      Asserts in debug builds if i is already dead; release builds ignore
+ *      the call.
+ */
+void ECE_EnemySwarm::kill(std::size_t i)
+{
+    assert(m_alive[i] && "kill() on an enemy that is already dead");
+    if (!m_alive[i])
+    { // a second kill would swap-remove another enemy's alive slot
+        return;
+    }
+    m_alive[i] = 0;
+
+    const std::uint32_t slot = m_alivePos[i];            // swap-remove from the alive index
+    const std::uint32_t last = m_aliveList.back();
+    m_aliveList[slot] = last;
+    m_alivePos[last]  = slot;
+    m_aliveList.pop_back();
+
+    const std::size_t column = m_column[i];
+    --m_colAlive[column];
+    if (m_colLeft[column] == i || m_colRight[column] == i)
+    { // killed one of the column's edge enemies
+        rescanColumn(column);
+    }
+    if (m_left == i || m_right == i)
+    { // killed one of the formation's edge enemies
+        rescanFormation();
+    }
+}
+
+/*
+ * Purpose:
+ *      Number of enemies still alive.
+ * Input(s):
+ *      None
+ * Output:
+ *      std::size_t - alive count
+ */
+std::size_t ECE_EnemySwarm::aliveCount() const
+{
+    return m_aliveList.size();
+}
+
+/*
+ * Purpose:
+ *      k-th entry of the dense alive index.
+ * Input(s):
+ *      std::size_t k - position in [0, aliveCount())
+ * Output:
+ *      std::size_t - enemy index of a live enemy
+ */
+std::size_t ECE_EnemySwarm::aliveAt(std::size_t k) const
+{
+    return m_aliveList[k];
+}
+
+/*
+ * Purpose:
+ *      Number of enemies still alive in a formation column.
+ * Input(s):
+ *      std::size_t column - column id given to add()
+ * Output:
+ *      std::size_t - alive count in that column
+ */
+std::size_t ECE_EnemySwarm::columnAliveCount(std::size_t column) const
+{
+    return column < m_colAlive.size() ? m_colAlive[column] : 0;
+}
+
+/*
+ * Purpose:
+ *      Recomputes a column's edge enemies from its alive members.
+ * Input(s):
+ *      std::size_t column - column id
+ * Output:
+ *      None
+ */
+void ECE_EnemySwarm::rescanColumn(std::size_t column)
+{
+    std::size_t left = npos, right = npos;
+    if (m_colAlive[column] > 0)
+    { // empty columns skip the scan and drop out of the formation rescan
+        for (const std::uint32_t j : m_colMembers[column])
+        {
+            if (!m_alive[j])
+            {
+                continue;
+            }
+            if (left == npos || leftEdge(j) < leftEdge(left))
+            {
+                left = j;
+            }
+            if (right == npos || rightEdge(j) > rightEdge(right))
+            {
+                right = j;
+            }
+        }
+    }
+    m_colLeft[column]  = left;
+    m_colRight[column] = right;
+}
+
+/*
+ * Purpose:
+ *      Recomputes the formation edge enemies from the column edges.
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_EnemySwarm::rescanFormation()
+{
+    m_left = m_right = npos;
+    for (std::size_t c = 0; c < m_colAlive.size(); ++c)
+    { // one comparison per column instead of one per enemy
+        if (m_colAlive[c] == 0)
+        {
+            continue;
+        }
+        if (m_left == npos || leftEdge(m_colLeft[c]) < leftEdge(m_left))
+        {
+            m_left = m_colLeft[c];
+        }
+        if (m_right == npos || rightEdge(m_colRight[c]) > rightEdge(m_right))
+        {
+            m_right = m_colRight[c];
+        }
+    }
+}
+
+/*
+ * Purpose:
+ *      Center position of enemy i.
+ * Input(s):
+ *      std::size_t i - enemy index
+ * Output:
+ *      Vector2f - position in pixels
+ */
+Vector2f ECE_EnemySwarm::getPosition(std::size_t i) const
+{
+    return {m_x[i], m_y[i]};
+}
+
+/*
+ * Purpose:
+ *      Center position of enemy i at the start of the last tick.
+ * Input(s):
+ *      std::size_t i - enemy index
+ * Output:
+ *      Vector2f - previous position in pixels
+ */
+Vector2f ECE_EnemySwarm::getPreviousPosition(std::size_t i) const
+{
+    return {m_prevX[i], m_prevY[i]};
+}
+
+/*
+ * Purpose:
+ *      Half width/height of enemy i.
+ * Input(s):
+ *      std::size_t i - enemy index
+ * Output:
+ *      Vector2f - half-extents in pixels
+ */
+Vector2f ECE_EnemySwarm::getHalfExtents(std::size_t i) const
+{
+    return {m_halfW[i], m_halfH[i]};
+}
+
+/*
+ * Purpose:
+ *      Texture id enemy i is drawn with.
+ * Input(s):
+ *      std::size_t i - enemy index
+ * Output:
+ *      EnemyTexture - texture id
+ */
+EnemyTexture ECE_EnemySwarm::getTexture(std::size_t i) const
+{
+    return static_cast<EnemyTexture>(m_texture[i]);
+}
+
+/*
+ * Purpose:
+ *      World-space bounding box of enemy i.
+ * Input(s):
+ *      std::size_t i - enemy index
+ * Output:
+ *      FloatRect - bounds in pixels
+ */
+FloatRect ECE_EnemySwarm::getBounds(std::size_t i) const
+{
+    return FloatRect(m_boxLeft[i], m_boxTop[i], m_boxW[i], m_boxH[i]);
+}
+
+/*
+ * Purpose:
+ *      Box covering enemy i over the last tick.
+ * Input(s):
+ *      std::size_t i - enemy index
+ * Output:
+ *      FloatRect - swept bounds in pixels
+ */
+FloatRect ECE_EnemySwarm::getSweptBounds(std::size_t i) const
+{
+    return sweptBounds({m_prevX[i], m_prevY[i]}, {m_x[i], m_y[i]}, {m_halfW[i], m_halfH[i]});
+}
+
+/*
+ * Purpose:
+ *      Copies current positions into the previous-position arrays.
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_EnemySwarm::savePreviousPositions()
+{
+    m_prevX = m_x;      // same size every tick, so this is a plain copy (no allocation)
+    m_prevY = m_y;
+}
+
+/*
+ * Purpose:
+ *      Moves the whole formation rigidly.
+ * Input(s):
+ *      float dx - horizontal offset in pixels
+ *      float dy - vertical offset in pixels
+ * Output:
+ *      None
+ */
+void ECE_EnemySwarm::move(float dx, float dy)
+{
+    const std::size_t n = m_x.size();
+    float* x = m_x.data();
+    float* y = m_y.data();
+    float* left = m_boxLeft.data();
+    float* top  = m_boxTop.data();
+    const float* halfW = m_halfW.data();
+    const float* halfH = m_halfH.data();
+    for (std::size_t i = 0; i < n; ++i)
+    { // contiguous, branch-free: vectorizes
+        x[i] += dx;
+        left[i] = x[i] - halfW[i];  // recomputed from the center (not left += dx) so it never drifts
+    }
+    if (dy != 0.f)
+    { // vertical step only happens on a wall bounce, so the top edges stay clean otherwise
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            y[i] += dy;
+            top[i] = y[i] - halfH[i];
+        }
+    }
+}
+
+/*
+ * Purpose:
+ *      Horizontal extent of the live part of the formation, in O(1).
+ * Input(s):
+ *      float& minLeft  - receives the smallest left edge
+ *      float& maxRight - receives the largest right edge
+ * Output:
+ *      bool - false if no enemy is alive (outputs are ±infinity)
+ */
+bool ECE_EnemySwarm::getExtent(float& minLeft, float& maxRight) const
+{
+    if (m_aliveList.empty())
+    {
+        minLeft  =  std::numeric_limits<float>::infinity();
+        maxRight = -std::numeric_limits<float>::infinity();
+        return false;
+    }
+    minLeft  = leftEdge(m_left);
+    maxRight = rightEdge(m_right);
+    return true;
+}
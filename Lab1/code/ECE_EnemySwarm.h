@@ -0,0 +1,301 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the ECE_EnemySwarm class. Stores the whole enemy formation
+as structure-of-arrays (positions, half-extents, alive flags, texture ids in
+separate contiguous vectors) instead of one sf::Sprite per enemy. Gameplay
+loops only touch the arrays they need; sprites are built by the front end
+at draw time from the position and texture id. Live enemies are also kept
+in a dense index (swap-remove on kill), so loops that only care about the
+living never visit the dead, and picking a random live enemy is O(1).
+Because the formation only moves rigidly, its horizontal extent is tracked
+incrementally: per-column alive counts and edge enemies are updated in
+kill(), so reading the extent is O(1).
+*/
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>   // sf::FloatRect for bounds queries
+#include <SFML/System/Vector2.hpp>  // sf::Vector2f for positions and extents
+#include <cstddef>                  // std::size_t for indices
+#include <cstdint>                  // std::uint8_t for flags and texture ids
+#include <vector>                   // std::vector for the component arrays
+
+// using namespace for readability
+using namespace sf;
+
+/*
+ * Purpose:
+ *      Which enemy texture an entry is drawn with.
+ * Values:
+ *      Enemy1 - bulldog (even rows)
+ *      Enemy2 - tigers  (odd rows)
+ */
+enum EnemyTexture : std::uint8_t
+{
+    Enemy1 = 0, Enemy2 = 1
+};
+
+/*
+ * Class: ECE_EnemySwarm
+ * Purpose: Structure-of-arrays store for the enemy formation.
+ * Notes:
+ *      Indices are stable for the life of a round; killing an enemy only
+ *      clears its alive flag and removes it from the alive index (whose
+ *      order therefore changes on every kill). Edges are tracked as the
+ *      index of the enemy that defines them, so a rigid move() never has
+ *      to touch them.
+ */
+class ECE_EnemySwarm
+{
+public:
+    /*
+     * Purpose:
+     *      Removes every enemy.
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void clear();
+
+    /*
+     * Purpose:
+     *      Pre-allocates storage for n enemies.
+     * Input(s):
+     *      std::size_t n - expected number of enemies
+     * Output:
+     *      None
+     */
+    void reserve(std::size_t n);
+
+    /*
+     * Purpose:
+     *      Appends a live enemy.
+     * Input(s):
+     *      Vector2f position     - center of the enemy in pixels
+     *      Vector2f halfExtents  - half width/height of its bounds in pixels
+     *      EnemyTexture texture  - texture id used when drawing
+     *      std::size_t column    - formation column the enemy belongs to
+     * Output:
+     *      std::size_t - index of the new enemy
+     */
+    std::size_t add(Vector2f position, Vector2f halfExtents, EnemyTexture texture, std::size_t column);
+
+    /*
+     * Purpose:
+     *      Number of enemies stored (alive or dead).
+     * Input(s):
+     *      None
+     * Output:
+     *      std::size_t - entry count
+     */
+    std::size_t size() const;
+
+    /*
+     * Purpose:
+     *      Checks whether enemy i is still alive.
+     * Input(s):
+     *      std::size_t i - enemy index
+     * Output:
+     *      bool - true if alive
+     */
+    bool isAlive(std::size_t i) const;
+
+    /*
+     * Purpose:
+     *      Marks enemy i as dead and updates its column's alive count and the
+     *      formation edges.
+     * Input(s):
+     *      std::size_t i - enemy index (must be alive)
+     * Output:
+     *      None
+     * Notes:
+     *      O(1) except when enemy i defined an edge: then its column's
+     *      members, and (if it was a formation edge) one entry per column,
+     *      are rescanned. Asserts in debug builds if i is already dead;
+     *      release builds ignore the call.
+     */
+    void kill(std::size_t i);
+
+    /*
+     * Purpose:
+     *      Number of enemies still alive.
+     * Input(s):
+     *      None
+     * Output:
+     *      std::size_t - alive count
+     */
+    std::size_t aliveCount() const;
+
+    /*
+     * Purpose:
+     *      k-th entry of the dense alive index.
+     * Input(s):
+     *      std::size_t k - position in [0, aliveCount())
+     * Output:
+     *      std::size_t - enemy index of a live enemy
+     * Notes:
+     *      Iterate k over [0, aliveCount()) to visit only live enemies.
+     */
+    std::size_t aliveAt(std::size_t k) const;
+
+    /*
+     * Purpose:
+     *      Number of enemies still alive in a formation column.
+     * Input(s):
+     *      std::size_t column - column id given to add()
+     * Output:
+     *      std::size_t - alive count in that column
+     */
+    std::size_t columnAliveCount(std::size_t column) const;
+
+    /*
+     * Purpose:
+     *      Center position of enemy i.
+     * Input(s):
+     *      std::size_t i - enemy index
+     * Output:
+     *      Vector2f - position in pixels
+     */
+    Vector2f getPosition(std::size_t i) const;
+
+    /*
+     * Purpose:
+     *      Center position of enemy i at the start of the last tick.
+     * Input(s):
+     *      std::size_t i - enemy index
+     * Output:
+     *      Vector2f - previous position in pixels
+     */
+    Vector2f getPreviousPosition(std::size_t i) const;
+
+    /*
+     * Purpose:
+     *      Half width/height of enemy i.
+     * Input(s):
+     *      std::size_t i - enemy index
+     * Output:
+     *      Vector2f - half-extents in pixels
+     */
+    Vector2f getHalfExtents(std::size_t i) const;
+
+    /*
+     * Purpose:
+     *      Texture id enemy i is drawn with.
+     * Input(s):
+     *      std::size_t i - enemy index
+     * Output:
+     *      EnemyTexture - texture id
+     */
+    EnemyTexture getTexture(std::size_t i) const;
+
+    /*
+     * Purpose:
+     *      World-space bounding box of enemy i (same box getGlobalBounds gave
+     *      for the centered, scaled sprite).
+     * Input(s):
+     *      std::size_t i - enemy index
+     * Output:
+     *      FloatRect - bounds in pixels
+     * Notes:
+     *      Read from the cached box arrays, which add() and move() keep in
+     *      step with the centers; no arithmetic happens here.
+     */
+    FloatRect getBounds(std::size_t i) const;
+
+    /*
+     * Purpose:
+     *      Box covering enemy i over the last tick (its previous and current
+     *      bounds together), for broadphases feeding swept tests.
+     * Input(s):
+     *      std::size_t i - enemy index
+     * Output:
+     *      FloatRect - swept bounds in pixels
+     */
+    FloatRect getSweptBounds(std::size_t i) const;
+
+    /*
+     * Purpose:
+     *      Copies current positions into the previous-position arrays
+     *      (render interpolation).
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void savePreviousPositions();
+
+    /*
+     * Purpose:
+     *      Moves the whole formation rigidly.
+     * Input(s):
+     *      float dx - horizontal offset in pixels
+     *      float dy - vertical offset in pixels
+     * Output:
+     *      None
+     * Notes:
+     *      Dead entries move too; they are never read, and skipping the
+     *      branch keeps the loop vectorizable. The cached boxes are refreshed
+     *      for the axes that moved (the top edges only on a wall step).
+     */
+    void move(float dx, float dy);
+
+    /*
+     * Purpose:
+     *      Horizontal extent of the live part of the formation, in O(1).
+     * Input(s):
+     *      float& minLeft  - receives the smallest left edge
+     *      float& maxRight - receives the largest right edge
+     * Output:
+     *      bool - false if no enemy is alive (outputs are ±infinity)
+     */
+    bool getExtent(float& minLeft, float& maxRight) const;
+
+private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);   // "no enemy"
+
+    // Both edges come from the cached box, so extents match getBounds()
+    float leftEdge(std::size_t i)  const { return m_boxLeft[i]; }
+    float rightEdge(std::size_t i) const { return m_boxLeft[i] + m_boxW[i]; }
+
+    /*
+     * Purpose:
+     *      Recomputes a column's edge enemies from its alive members.
+     * Input(s):
+     *      std::size_t column - column id
+     * Output:
+     *      None
+     */
+    void rescanColumn(std::size_t column);
+
+    /*
+     * Purpose:
+     *      Recomputes the formation edge enemies from the column edges.
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void rescanFormation();
+
+    std::vector<float>        m_x, m_y;             // current centers
+    std::vector<float>        m_prevX, m_prevY;     // centers at the start of the tick
+    std::vector<float>        m_halfW, m_halfH;     // half-extents
+    std::vector<float>        m_boxLeft, m_boxTop;  // cached world box corner (center - half-extent)
+    std::vector<float>        m_boxW, m_boxH;       // cached world box size (2 * half-extent, fixed per entry)
+    std::vector<std::uint8_t> m_alive;              // 1 = alive, 0 = dead
+    std::vector<std::uint8_t> m_texture;            // EnemyTexture per entry
+    std::vector<std::uint32_t> m_column;            // formation column per entry
+
+    std::vector<std::vector<std::uint32_t>> m_colMembers;   // enemy indices per column (built by add)
+    std::vector<std::uint32_t> m_colAlive;                  // alive count per column
+    std::vector<std::size_t>   m_colLeft, m_colRight;       // edge-defining enemy per column (npos if empty)
+
+    std::vector<std::uint32_t> m_aliveList;         // dense index of live enemies (unordered)
+    std::vector<std::uint32_t> m_alivePos;          // slot of each live enemy in m_aliveList
+    std::size_t m_left  = npos;                     // enemy with the smallest left edge
+    std::size_t m_right = npos;                     // enemy with the largest right edge
+};
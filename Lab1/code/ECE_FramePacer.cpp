@@ -0,0 +1,156 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_FramePacer class. OS sleeps wake up late by
+a platform-dependent amount (about 0.1 ms on Linux, up to 1-2 ms on
+Windows), so the pacer keeps a running estimate of that overshoot, sleeps
+only until that far ahead of the deadline, and spins the rest.
+*/
+
+#include "ECE_FramePacer.h"     // Class declaration and interface
+#include <algorithm>            // std::max / std::min for the estimates
+#include <cmath>                // std::sqrt / std::fabs for the statistics
+#include <thread>               // std::this_thread::sleep_for / yield
+
+/*
+ * Purpose:
+ *      Creates a pacer for the given rate.
+ * Input(s):
+ *      float targetHz - frames per second (0 = no limit)
+ * Output:
+ *      None (constructor).
+ */
+ECE_FramePacer::ECE_FramePacer(float targetHz)
+{
+    setTargetRate(targetHz);
+}
+
+/*
+ * Purpose:
+ *      Changes the target rate and restarts the deadline grid.
+ * Input(s):
+ *      float targetHz - frames per second (0 = no limit)
+ * Output:
+ *      None
+ */
+void ECE_FramePacer::setTargetRate(float targetHz)
+{
+    m_targetHz = std::max(0.f, targetHz);
+    m_period   = (m_targetHz > 0.f)
+               ? std::chrono::duration_cast<PacerClock::duration>(std::chrono::duration<double>(1.0 / m_targetHz))
+               : PacerClock::duration::zero();
+    restart();
+}
+
+/*
+ * Purpose:
+ *      Forgets the previous frame so a pause is not counted as an interval.
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_FramePacer::restart()
+{
+    m_haveLast = false;
+    m_deadline = PacerClock::now() + m_period;
+}
+
+/*
+ * Purpose:
+ *      Blocks until the next frame deadline, then records the interval.
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_FramePacer::wait()
+{
+    if (m_period > PacerClock::duration::zero())
+    {
+        PacerClock::time_point now = PacerClock::now();
+        if (now - m_deadline > m_period)
+        { // more than a whole frame behind: start a fresh grid from here
+            m_deadline = now;
+        }
+
+        // Coarse phase: sleep while the deadline is further away than a typical oversleep
+        const auto margin = std::chrono::duration<double>(m_sleepOvershoot + 0.0002);
+        const auto sleepFor = std::chrono::duration<double>(m_deadline - now) - margin;
+        if (sleepFor.count() > 0.0)
+        {
+            std::this_thread::sleep_for(sleepFor);
+            const auto woke = PacerClock::now();
+            const double over = std::chrono::duration<double>(woke - now).count() - sleepFor.count();
+            m_sleepOvershoot = std::min(0.004, std::max(0.0, 0.9 * m_sleepOvershoot + 0.1 * over));
+        }
+
+        // Fine phase: spin (yielding) for the last fraction of a millisecond
+        while (PacerClock::now() < m_deadline)
+        {
+            std::this_thread::yield();
+        }
+        m_deadline += m_period;
+    }
+
+    const PacerClock::time_point frameEnd = PacerClock::now();
+    if (m_haveLast)
+    {
+        const double interval = std::chrono::duration<double>(frameEnd - m_lastFrame).count();
+        const double target   = (m_period > PacerClock::duration::zero())
+                              ? std::chrono::duration<double>(m_period).count()
+                              : (m_frames > 0 ? m_sum / m_frames : interval);
+        ++m_frames;
+        m_sum   += interval;
+        m_sumSq += interval * interval;
+        m_maxDev = std::max(m_maxDev, std::fabs(interval - target));
+        if (m_period > PacerClock::duration::zero() && interval > 1.5 * target)
+        {
+            ++m_late;
+        }
+    }
+    m_lastFrame = frameEnd;
+    m_haveLast  = true;
+}
+
+/*
+ * Purpose:
+ *      Statistics over the intervals measured since resetStats().
+ * Input(s):
+ *      None
+ * Output:
+ *      FramePacingStats - summary of the measured intervals
+ */
+FramePacingStats ECE_FramePacer::stats() const
+{
+    FramePacingStats s;
+    s.frames = m_frames;
+    if (m_frames > 0)
+    {
+        const double mean = m_sum / m_frames;
+        s.meanMs         = mean * 1e3;
+        s.jitterMs       = std::sqrt(std::max(0.0, m_sumSq / m_frames - mean * mean)) * 1e3;
+        s.maxDeviationMs = m_maxDev * 1e3;
+        s.lateFrames     = m_late;
+    }
+    return s;
+}
+
+/*
+ * Purpose:
+ *      Clears the measured intervals (the deadline grid is kept).
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_FramePacer::resetStats()
+{
+    m_frames = 0;
+    m_sum    = 0.0;
+    m_sumSq  = 0.0;
+    m_maxDev = 0.0;
+    m_late   = 0;
+}
@@ -0,0 +1,128 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the ECE_FramePacer class. Holds the render loop to a target
+frame rate: frame deadlines are scheduled on a fixed grid (so one slow frame
+does not shift every later one), the wait sleeps while it is safely far from
+the deadline and spins the last fraction of a millisecond, and the actual
+frame intervals are measured so pacing jitter can be reported.
+*/
+
+#pragma once
+
+#include <chrono>               // std::chrono::steady_clock for deadlines
+#include <cstddef>              // std::size_t for frame counts
+
+/*
+ * Purpose:
+ *      Measured frame intervals since the last reset.
+ * Fields:
+ *      frames          - intervals measured
+ *      meanMs          - average interval
+ *      jitterMs        - standard deviation of the interval
+ *      maxDeviationMs  - worst |interval - target| (0 target = vs. the mean)
+ *      lateFrames      - intervals over 1.5x the target period
+ */
+struct FramePacingStats
+{
+    std::size_t frames         = 0;
+    double      meanMs         = 0.0;
+    double      jitterMs       = 0.0;
+    double      maxDeviationMs = 0.0;
+    std::size_t lateFrames     = 0;
+};
+
+/*
+ * Class: ECE_FramePacer
+ * Purpose: Frame-rate limiter with sub-millisecond accuracy and statistics.
+ * Notes:
+ *      Call wait() once per frame, right after display(). With a target of
+ *      0 (uncapped, or vsync doing the pacing) wait() only measures.
+ */
+class ECE_FramePacer
+{
+public:
+    /*
+     * Purpose:
+     *      Creates a pacer for the given rate.
+     * Input(s):
+     *      float targetHz - frames per second (0 = no limit)
+     * Output:
+     *      None (constructor).
+     */
+    explicit ECE_FramePacer(float targetHz = 60.f);
+
+    /*
+     * Purpose:
+     *      Changes the target rate and restarts the deadline grid.
+     * Input(s):
+     *      float targetHz - frames per second (0 = no limit)
+     * Output:
+     *      None
+     */
+    void setTargetRate(float targetHz);
+
+    /*
+     * Purpose:
+     *      Blocks until the next frame deadline, then records the interval.
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     * Notes:
+     *      A frame that is already more than a period late resynchronizes
+     *      the grid instead of rushing the following frames to catch up.
+     */
+    void wait();
+
+    /*
+     * Purpose:
+     *      Forgets the previous frame, e.g. after a modal screen, so the
+     *      pause is not counted as one huge interval.
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void restart();
+
+    /*
+     * Purpose:
+     *      Statistics over the intervals measured since resetStats().
+     * Input(s):
+     *      None
+     * Output:
+     *      FramePacingStats - summary of the measured intervals
+     */
+    FramePacingStats stats() const;
+
+    /*
+     * Purpose:
+     *      Clears the measured intervals (the deadline grid is kept).
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void resetStats();
+
+    float targetRate() const { return m_targetHz; }
+
+private:
+    using PacerClock = std::chrono::steady_clock;
+
+    float                  m_targetHz;
+    PacerClock::duration   m_period;                  // zero when uncapped
+    PacerClock::time_point m_deadline;                // next frame boundary
+    PacerClock::time_point m_lastFrame;               // when the previous wait() returned
+    bool                   m_haveLast = false;
+    double                 m_sleepOvershoot = 0.001;  // running estimate of how late sleep_for wakes (s)
+
+    std::size_t m_frames  = 0;
+    double      m_sum     = 0.0;                      // interval sums in seconds
+    double      m_sumSq   = 0.0;
+    double      m_maxDev  = 0.0;
+    std::size_t m_late    = 0;
+};
@@ -0,0 +1,147 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the laser projectile kernels. The instruction set is
+picked at compile time (BUZZY_ENABLE_AVX2 adds -mavx2; BUZZY_NO_SIMD forces
+the scalar path). Vector loops handle whole groups of lanes and leave the
+remainder to the scalar tail, so any array length works with unaligned data.
+*/
+
+#include "ECE_LaserKernels.h"   // Kernel declarations
+
+#if !defined(BUZZY_NO_SIMD) && defined(__AVX2__)
+#define BUZZY_LASER_AVX2 1
+#include <immintrin.h>          // AVX/AVX2 intrinsics
+#elif !defined(BUZZY_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define BUZZY_LASER_SSE2 1
+#include <emmintrin.h>          // SSE2 intrinsics
+#endif
+
+/*
+ * Purpose:
+ *      Advances n shots: x += vx * dt, y += vy * dt.
+ * Input(s):
+ *      float* x, y           - positions (updated in place)
+ *      const float* vx, vy   - velocities in pixels per second
+ *      std::size_t n         - number of shots
+ *      float dt              - seconds since last tick
+ * Output:
+ *      None
+ */
+void integrateShots(float* x, float* y, const float* vx, const float* vy, std::size_t n, float dt)
+{
+    std::size_t i = 0;
+
+#if defined(BUZZY_LASER_AVX2)
+    const __m256 vdt = _mm256_set1_ps(dt);
+    for (; i + 8 <= n; i += 8)
+    { // separate mul and add (no FMA) so the result matches the scalar tail exactly
+        _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_mul_ps(_mm256_loadu_ps(vx + i), vdt)));
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(_mm256_loadu_ps(vy + i), vdt)));
+    }
+#elif defined(BUZZY_LASER_SSE2)
+    const __m128 vdt = _mm_set1_ps(dt);
+    for (; i + 4 <= n; i += 4)
+    {
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(_mm_loadu_ps(vx + i), vdt)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_loadu_ps(vy + i), vdt)));
+    }
+#endif
+
+    for (; i < n; ++i)
+    { // scalar fallback / remainder
+        x[i] += vx[i] * dt;
+        y[i] += vy[i] * dt;
+    }
+}
+
+/*
+ * Purpose:
+ *      Finds the first shot in [begin, end) that is completely above or
+ *      below the window.
+ * Input(s):
+ *      const float* y        - shot centers
+ *      std::size_t begin     - first index to test
+ *      std::size_t end       - one past the last index to test
+ *      float halfHeight      - half height shared by every shot
+ *      float windowHeight    - total height of the game window in pixels
+ * Output:
+ *      std::size_t - index of the first off-screen shot, or end if none
+ */
+std::size_t findOffScreenShot(const float* y, std::size_t begin, std::size_t end,
+                              float halfHeight, float windowHeight)
+{
+    std::size_t i = begin;
+
+#if defined(BUZZY_LASER_AVX2)
+    const __m256 h    = _mm256_set1_ps(halfHeight);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 top  = _mm256_set1_ps(windowHeight);
+    for (; i + 8 <= end; i += 8)
+    {
+        const __m256 v     = _mm256_loadu_ps(y + i);
+        const __m256 above = _mm256_cmp_ps(_mm256_add_ps(v, h), zero, _CMP_LT_OQ);
+        const __m256 below = _mm256_cmp_ps(_mm256_sub_ps(v, h), top,  _CMP_GT_OQ);
+        const int mask = _mm256_movemask_ps(_mm256_or_ps(above, below));
+        if (mask != 0)
+        { // lowest set bit is the first off-screen lane
+            int lane = 0;
+            while (((mask >> lane) & 1) == 0)
+            {
+                ++lane;
+            }
+            return i + static_cast<std::size_t>(lane);
+        }
+    }
+#elif defined(BUZZY_LASER_SSE2)
+    const __m128 h    = _mm_set1_ps(halfHeight);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 top  = _mm_set1_ps(windowHeight);
+    for (; i + 4 <= end; i += 4)
+    {
+        const __m128 v     = _mm_loadu_ps(y + i);
+        const __m128 above = _mm_cmplt_ps(_mm_add_ps(v, h), zero);
+        const __m128 below = _mm_cmpgt_ps(_mm_sub_ps(v, h), top);
+        const int mask = _mm_movemask_ps(_mm_or_ps(above, below));
+        if (mask != 0)
+        {
+            int lane = 0;
+            while (((mask >> lane) & 1) == 0)
+            {
+                ++lane;
+            }
+            return i + static_cast<std::size_t>(lane);
+        }
+    }
+#endif
+
+    for (; i < end; ++i)
+    { // scalar fallback / remainder
+        if ((y[i] + halfHeight < 0.f) || (y[i] - halfHeight > windowHeight))
+        {
+            return i;
+        }
+    }
+    return end;
+}
+
+/*
+ * Purpose:
+ *      Names the instruction set the kernels were compiled for.
+ * Input(s):
+ *      None
+ * Output:
+ *      const char* - "avx2", "sse2" or "scalar"
+ */
+const char* laserKernelIsa()
+{
+#if defined(BUZZY_LASER_AVX2)
+    return "avx2";
+#elif defined(BUZZY_LASER_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
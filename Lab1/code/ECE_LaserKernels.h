@@ -0,0 +1,57 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the laser projectile kernels. Integration and the off-screen
+test run over the ECE_LaserPool position/velocity arrays several shots at a
+time: AVX2 (8 lanes) when the build enables it, SSE2 (4 lanes) on any x86-64
+build, and a plain scalar loop everywhere else. Every path does the same
+float operations in the same order, so results are bit-identical.
+*/
+
+#pragma once
+
+#include <cstddef>  // std::size_t for counts and indices
+
+/*
+ * Purpose:
+ *      Advances n shots: x += vx * dt, y += vy * dt.
+ * Input(s):
+ *      float* x, y           - positions (updated in place)
+ *      const float* vx, vy   - velocities in pixels per second
+ *      std::size_t n         - number of shots
+ *      float dt              - seconds since last tick
+ * Output:
+ *      None
+ */
+void integrateShots(float* x, float* y, const float* vx, const float* vy, std::size_t n, float dt);
+
+/*
+ * Purpose:
+ *      Finds the first shot in [begin, end) that is completely above or
+ *      below the window (y + halfHeight < 0 or y - halfHeight > windowHeight).
+ * Input(s):
+ *      const float* y        - shot centers
+ *      std::size_t begin     - first index to test
+ *      std::size_t end       - one past the last index to test
+ *      float halfHeight      - half height shared by every shot
+ *      float windowHeight    - total height of the game window in pixels
+ * Output:
+ *      std::size_t - index of the first off-screen shot, or end if none
+ * Notes:
+ *      Whole vectors of on-screen shots are skipped with one compare and
+ *      one movemask, so a cull pass costs little more than reading y once.
+ */
+std::size_t findOffScreenShot(const float* y, std::size_t begin, std::size_t end,
+                              float halfHeight, float windowHeight);
+
+/*
+ * Purpose:
+ *      Names the instruction set the kernels were compiled for.
+ * Input(s):
+ *      None
+ * Output:
+ *      const char* - "avx2", "sse2" or "scalar"
+ */
+const char* laserKernelIsa();
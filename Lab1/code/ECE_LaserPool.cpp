@@ -0,0 +1,150 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_LaserPool class. Storage is sized once in the
+constructor; nothing after that allocates. The per-tick integration and
+off-screen scan run through the vector kernels in ECE_LaserKernels.
+*/
+
+#include "ECE_LaserPool.h"      // Class declaration and interface
+#include "ECE_Components.h"     // centeredBounds for the hitbox rectangles
+#include "ECE_LaserKernels.h"   // integrateShots / findOffScreenShot
+
+/*
+ * Purpose:
+ *      Allocates storage for up to capacity shots.
+ * Input(s):
+ *      std::size_t capacity  - hard cap on live shots
+ *      Vector2f halfExtents  - half width/height shared by every shot
+ * Output:
+ *      None (constructor).
+ */
+ECE_LaserPool::ECE_LaserPool(std::size_t capacity, Vector2f halfExtents)
+: m_x(capacity), m_y(capacity),
+  m_prevX(capacity), m_prevY(capacity),
+  m_vx(capacity), m_vy(capacity),
+  m_half(halfExtents)
+{
+}
+
+/*
+ * Purpose:
+ *      Adds a shot if there is room.
+ * Input(s):
+ *      Vector2f position - center of the shot in pixels
+ *      Vector2f velocity - pixels per second
+ * Output:
+ *      bool - false if the pool is full (the shot is dropped and counted)
+ */
+bool ECE_LaserPool::spawn(Vector2f position, Vector2f velocity)
+{
+    if (m_count == m_x.size())
+    { // hard cap reached
+        ++m_dropped;
+        return false;
+    }
+
+    const std::size_t i = m_count++;
+    m_x[i]  = position.x;  m_y[i]  = position.y;
+    m_prevX[i] = position.x; m_prevY[i] = position.y;     // no interpolation from the origin on its first frame
+    m_vx[i] = velocity.x;  m_vy[i] = velocity.y;
+
+    ++m_spawned;
+    if (m_count > m_highWater)
+    {
+        m_highWater = m_count;
+    }
+    return true;
+}
+
+/*
+ * Purpose:
+ *      Removes shot i by moving the last live shot into its slot.
+ * Input(s):
+ *      std::size_t i - index of a live shot
+ * Output:
+ *      None
+ */
+void ECE_LaserPool::despawn(std::size_t i)
+{
+    const std::size_t last = --m_count;
+    m_x[i]     = m_x[last];     m_y[i]     = m_y[last];
+    m_prevX[i] = m_prevX[last]; m_prevY[i] = m_prevY[last];
+    m_vx[i]    = m_vx[last];    m_vy[i]    = m_vy[last];
+}
+
+/*
+ * Purpose:
+ *      Removes every shot (counters are kept).
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_LaserPool::clear()
+    {
+        m_count = 0;
+    }
+
+/*
+ * Purpose:
+ *      Moves every shot by velocity * dt.
+ * Input(s):
+ *      float dt - seconds since last tick
+ * Output:
+ *      None
+ */
+void ECE_LaserPool::update(float dt)
+{
+    integrateShots(m_x.data(), m_y.data(), m_vx.data(), m_vy.data(), m_count, dt);
+}
+
+/*
+ * Purpose:
+ *      Despawns every shot that is completely above or below the window.
+ * Input(s):
+ *      float windowHeight - total height of the game window in pixels
+ * Output:
+ *      None
+ */
+void ECE_LaserPool::cullOffScreen(float windowHeight)
+{
+    std::size_t i = findOffScreenShot(m_y.data(), 0, m_count, m_half.y, windowHeight);
+    while (i < m_count)
+    { // removes shot if it left the screen; slot i now holds a new shot, so resume the scan at i
+        despawn(i);
+        i = findOffScreenShot(m_y.data(), i, m_count, m_half.y, windowHeight);
+    }
+}
+
+/*
+ * Purpose:
+ *      Copies current positions into the previous-position arrays.
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_LaserPool::savePreviousPositions()
+{
+    for (std::size_t i = 0; i < m_count; ++i)
+    {
+        m_prevX[i] = m_x[i];
+        m_prevY[i] = m_y[i];
+    }
+}
+
+/*
+ * Purpose:
+ *      World-space bounding box of shot i.
+ * Input(s):
+ *      std::size_t i - shot index
+ * Output:
+ *      FloatRect - bounds in pixels
+ */
+FloatRect ECE_LaserPool::getBounds(std::size_t i) const
+{
+    return centeredBounds(m_x[i], m_y[i], m_half.x, m_half.y);
+}
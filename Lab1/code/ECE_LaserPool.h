@@ -0,0 +1,145 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the ECE_LaserPool class. A fixed-capacity, allocation-free
+store for laser projectiles. Live shots are kept densely packed at the front
+of structure-of-arrays storage; despawning swaps the last shot into the hole,
+so spawn and despawn are both O(1) and the per-tick walks touch only live
+shots in contiguous memory. All lasers share one hitbox size.
+*/
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>   // sf::FloatRect for bounds queries
+#include <SFML/System/Vector2.hpp>  // sf::Vector2f for positions and velocities
+#include <cstddef>                  // std::size_t for indices and counters
+#include <vector>                   // std::vector for the component arrays (sized once)
+
+// using namespace for readability
+using namespace sf;
+
+/*
+ * Class: ECE_LaserPool
+ * Purpose: Dense swap-remove pool of laser projectiles with a hard cap.
+ * Notes:
+ *      Indices are only stable until the next despawn(): despawn(i) moves the
+ *      last live shot into slot i. Loops that despawn while iterating must
+ *      re-test slot i instead of advancing.
+ */
+class ECE_LaserPool
+{
+public:
+    /*
+     * Purpose:
+     *      Allocates storage for up to capacity shots (the only allocation
+     *      the pool ever makes).
+     * Input(s):
+     *      std::size_t capacity  - hard cap on live shots
+     *      Vector2f halfExtents  - half width/height shared by every shot
+     * Output:
+     *      None (constructor).
+     */
+    ECE_LaserPool(std::size_t capacity, Vector2f halfExtents);
+
+    /*
+     * Purpose:
+     *      Adds a shot if there is room.
+     * Input(s):
+     *      Vector2f position - center of the shot in pixels
+     *      Vector2f velocity - pixels per second
+     * Output:
+     *      bool - false if the pool is full (the shot is dropped and counted)
+     */
+    bool spawn(Vector2f position, Vector2f velocity);
+
+    /*
+     * Purpose:
+     *      Removes shot i by moving the last live shot into its slot.
+     * Input(s):
+     *      std::size_t i - index of a live shot
+     * Output:
+     *      None
+     */
+    void despawn(std::size_t i);
+
+    /*
+     * Purpose:
+     *      Removes every shot (counters are kept).
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void clear();
+
+    /*
+     * Purpose:
+     *      Moves every shot by velocity * dt.
+     * Input(s):
+     *      float dt - seconds since last tick
+     * Output:
+     *      None
+     * Notes:
+     *      Runs the SIMD integration kernel over the packed arrays.
+     */
+    void update(float dt);
+
+    /*
+     * Purpose:
+     *      Despawns every shot that is completely above or below the window.
+     * Input(s):
+     *      float windowHeight - total height of the game window in pixels
+     * Output:
+     *      None
+     * Notes:
+     *      A SIMD scan skips runs of on-screen shots; despawn order is the
+     *      same as a one-at-a-time walk.
+     */
+    void cullOffScreen(float windowHeight);
+
+    /*
+     * Purpose:
+     *      Copies current positions into the previous-position arrays
+     *      (render interpolation).
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void savePreviousPositions();
+
+    std::size_t size()      const { return m_count; }       // live shots
+    std::size_t capacity()  const { return m_x.size(); }    // hard cap
+    bool        empty()     const { return m_count == 0; }
+
+    Vector2f  getPosition(std::size_t i)         const { return {m_x[i], m_y[i]}; }
+    Vector2f  getPreviousPosition(std::size_t i) const { return {m_prevX[i], m_prevY[i]}; }
+    Vector2f  getVelocity(std::size_t i)         const { return {m_vx[i], m_vy[i]}; }
+    Vector2f  getHalfExtents()                   const { return m_half; }
+
+    /*
+     * Purpose:
+     *      World-space bounding box of shot i.
+     * Input(s):
+     *      std::size_t i - shot index
+     * Output:
+     *      FloatRect - bounds in pixels
+     */
+    FloatRect getBounds(std::size_t i) const;
+
+    std::size_t highWaterMark() const { return m_highWater; }   // most shots ever live at once
+    std::size_t spawnedCount()  const { return m_spawned; }     // shots accepted by spawn()
+    std::size_t droppedCount()  const { return m_dropped; }     // shots refused because the pool was full
+
+private:
+    std::vector<float> m_x, m_y;            // current centers
+    std::vector<float> m_prevX, m_prevY;    // centers at the start of the tick
+    std::vector<float> m_vx, m_vy;          // velocities (pixels per second)
+    Vector2f    m_half;                     // shared half-extents
+    std::size_t m_count     = 0;            // live shots occupy [0, m_count)
+    std::size_t m_highWater = 0;
+    std::size_t m_spawned   = 0;
+    std::size_t m_dropped   = 0;
+};
@@ -0,0 +1,235 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the frame profiler. Each thread owns one
+ThreadRecord: a ring of the most recent zone events and a per-site array of
+totals. The owning thread is the only writer; the ring head is published
+with a release store so an exporter on another thread sees complete events.
+The only lock is taken once per thread (registering its record) and once
+per call site.
+*/
+
+#include "ECE_Profiler.h"       // Zone macros and class declarations
+
+#ifdef BUZZY_PROFILING
+
+#include <algorithm>            // std::sort for the summary
+#include <array>                // std::array for the event ring
+#include <atomic>               // std::atomic for the ring head
+#include <cstdio>               // std::fprintf for the trace JSON
+#include <iostream>             // std::cout for report
+#include <iomanip>              // std::setw / std::setprecision for the summary table
+#include <memory>               // std::unique_ptr for thread records
+#include <mutex>                // std::mutex for the registries
+#include <vector>               // std::vector for registries and totals
+
+namespace
+{
+    constexpr std::size_t kRingSize = 1 << 16;      // events kept per thread (about 1.5 MB)
+    constexpr std::size_t kMaxSites = 256;          // zone call sites in the whole program
+
+    struct Event
+    {
+        std::uint32_t site;
+        std::uint64_t startNs;
+        std::uint64_t durNs;
+    };
+
+    struct SiteTotal
+    {
+        std::uint64_t calls = 0;
+        std::uint64_t totalNs = 0;
+        std::uint64_t maxNs = 0;
+    };
+
+    struct ThreadRecord
+    {
+        std::uint32_t                     tid = 0;
+        std::array<Event, kRingSize>      ring;
+        std::atomic<std::uint64_t>        head{0};      // events ever written; ring[head % size] is next
+        std::array<SiteTotal, kMaxSites>  totals;
+    };
+
+    const std::chrono::steady_clock::time_point g_epoch = std::chrono::steady_clock::now();
+
+    std::mutex                                 g_registryMutex;
+    std::vector<std::unique_ptr<ThreadRecord>> g_threads;          // kept after thread exit so its events survive
+    std::vector<const char*>                   g_siteNames;        // indexed by site id
+
+    /*
+     * Purpose:
+     *      The calling thread's record, created on its first zone.
+     * Input(s):
+     *      None
+     * Output:
+     *      ThreadRecord& - this thread's record
+     */
+    ThreadRecord& threadRecord()
+    {
+        thread_local ThreadRecord* record = nullptr;
+        if (!record)
+        {
+            std::unique_ptr<ThreadRecord> fresh(new ThreadRecord);
+            std::lock_guard<std::mutex> lock(g_registryMutex);
+            fresh->tid = static_cast<std::uint32_t>(g_threads.size() + 1);
+            record = fresh.get();
+            g_threads.push_back(std::move(fresh));
+        }
+        return *record;
+    }
+}
+
+/*
+ * Purpose:
+ *      Registers a zone name and assigns it the next site id.
+ * Input(s):
+ *      const char* name - zone name; must outlive the program (a literal)
+ * Output:
+ *      None (constructor).
+ */
+ECE_ProfileSite::ECE_ProfileSite(const char* name)
+: m_name(name)
+{
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    m_id = g_siteNames.size() < kMaxSites ? g_siteNames.size() : kMaxSites - 1;   // overflow sites share the last slot
+    if (g_siteNames.size() < kMaxSites)
+    {
+        g_siteNames.push_back(name);
+    }
+}
+
+/*
+ * Purpose:
+ *      Stops the timer and records the zone on the calling thread.
+ * Input(s):
+ *      None
+ * Output:
+ *      None (destructor).
+ */
+ECE_ProfileZone::~ECE_ProfileZone()
+{
+    const auto end = std::chrono::steady_clock::now();
+    const std::uint64_t startNs = std::chrono::duration_cast<std::chrono::nanoseconds>(m_start - g_epoch).count();
+    const std::uint64_t durNs   = std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_start).count();
+
+    ThreadRecord& rec = threadRecord();
+    const std::uint64_t h = rec.head.load(std::memory_order_relaxed);     // only this thread writes head
+    rec.ring[h % kRingSize] = {static_cast<std::uint32_t>(m_site.id()), startNs, durNs};
+    rec.head.store(h + 1, std::memory_order_release);
+
+    SiteTotal& t = rec.totals[m_site.id()];
+    ++t.calls;
+    t.totalNs += durNs;
+    t.maxNs = std::max(t.maxNs, durNs);
+}
+
+/*
+ * Purpose:
+ *      Writes every thread's ring as Chrome trace-event JSON ("X" events).
+ * Input(s):
+ *      const std::string& path - output file
+ * Output:
+ *      bool - false if the file could not be written
+ */
+bool ECE_Profiler::writeChromeTrace(const std::string& path)
+{
+    std::FILE* f = std::fopen(path.c_str(), "w");
+    if (!f)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    std::fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+    for (const auto& rec : g_threads)
+    {
+        const std::uint64_t head  = rec->head.load(std::memory_order_acquire);
+        const std::uint64_t begin = head > kRingSize ? head - kRingSize : 0;     // oldest event still in the ring
+        for (std::uint64_t i = begin; i < head; ++i)
+        {
+            const Event& e = rec->ring[i % kRingSize];
+            std::fprintf(f, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                         first ? "" : ",\n", g_siteNames[e.site], rec->tid, e.startNs / 1000.0, e.durNs / 1000.0);
+            first = false;
+        }
+    }
+    std::fprintf(f, "\n]}\n");
+    return std::fclose(f) == 0;
+}
+
+/*
+ * Purpose:
+ *      Prints calls, total, mean and max time per zone over the whole run.
+ * Input(s):
+ *      std::ostream& out - destination (e.g. std::cout)
+ * Output:
+ *      None
+ */
+void ECE_Profiler::writeSummary(std::ostream& out)
+{
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+
+    std::vector<SiteTotal> sum(g_siteNames.size());
+    for (const auto& rec : g_threads)
+    { // merge every thread's totals
+        for (std::size_t s = 0; s < sum.size(); ++s)
+        {
+            sum[s].calls   += rec->totals[s].calls;
+            sum[s].totalNs += rec->totals[s].totalNs;
+            sum[s].maxNs    = std::max(sum[s].maxNs, rec->totals[s].maxNs);
+        }
+    }
+
+    std::vector<std::size_t> order;
+    for (std::size_t s = 0; s < sum.size(); ++s)
+    {
+        if (sum[s].calls > 0)
+        {
+            order.push_back(s);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b)
+    {
+        return sum[a].totalNs > sum[b].totalNs;
+    });
+
+    out << std::left << std::setw(26) << "zone" << std::right
+        << std::setw(10) << "calls" << std::setw(12) << "total ms"
+        << std::setw(12) << "mean us" << std::setw(12) << "max us" << "\n";
+    out << std::fixed << std::setprecision(3);
+    for (const std::size_t s : order)
+    {
+        out << std::left << std::setw(26) << g_siteNames[s] << std::right
+            << std::setw(10) << sum[s].calls
+            << std::setw(12) << sum[s].totalNs / 1e6
+            << std::setw(12) << sum[s].totalNs / 1e3 / sum[s].calls
+            << std::setw(12) << sum[s].maxNs / 1e3 << "\n";
+    }
+    out.unsetf(std::ios::floatfield);
+}
+
+/*
+ * Purpose:
+ *      End-of-run report: writes the trace file and prints the summary.
+ * Input(s):
+ *      const std::string& tracePath - Chrome trace output file
+ * Output:
+ *      None
+ */
+void ECE_Profiler::report(const std::string& tracePath)
+{
+    writeSummary(std::cout);
+    if (writeChromeTrace(tracePath))
+    {
+        std::cout << "profile trace: " << tracePath << std::endl;
+    }
+    else
+    {
+        std::cerr << "profile trace: cannot write " << tracePath << std::endl;
+    }
+}
+
+#endif
@@ -0,0 +1,141 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the frame profiler. BUZZY_PROFILE_ZONE("name") times the
+rest of the enclosing scope; BUZZY_PROFILE_REPORT("file.json") writes
+everything recorded so far. Each thread records its zones into its own
+fixed-size ring buffer (newest events overwrite the oldest) plus running
+per-zone totals, so recording never takes a lock or allocates. At exit the
+rings are written as Chrome trace-event JSON (open in chrome://tracing or
+ui.perfetto.dev) and the totals as a per-phase summary.
+
+Everything here is compiled out unless BUZZY_PROFILING is defined (CMake
+option BUZZY_PROFILING); the macros then expand to nothing.
+*/
+
+#pragma once
+
+#ifdef BUZZY_PROFILING
+
+#include <chrono>               // std::chrono::steady_clock for timestamps
+#include <cstddef>              // std::size_t for ids and counts
+#include <cstdint>              // std::uint64_t for nanosecond times
+#include <ostream>              // std::ostream for the summary
+#include <string>               // std::string for the trace path
+
+/*
+ * Class: ECE_ProfileSite
+ * Purpose: One BUZZY_PROFILE_ZONE call site: its name and a dense id.
+ * Notes:
+ *      Created as a function-local static by the macro, so registration
+ *      happens once per site (thread-safe static init).
+ */
+class ECE_ProfileSite
+{
+public:
+    /*
+     * Purpose:
+     *      Registers a zone name and assigns it the next site id.
+     * Input(s):
+     *      const char* name - zone name; must outlive the program (a literal)
+     * Output:
+     *      None (constructor).
+     */
+    explicit ECE_ProfileSite(const char* name);
+
+    const char* name() const { return m_name; }
+    std::size_t id()   const { return m_id; }
+
+private:
+    const char* m_name;
+    std::size_t m_id;
+};
+
+/*
+ * Class: ECE_ProfileZone
+ * Purpose: RAII timer; records [construction, destruction) for its site.
+ */
+class ECE_ProfileZone
+{
+public:
+    explicit ECE_ProfileZone(const ECE_ProfileSite& site)
+    : m_site(site), m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    /*
+     * Purpose:
+     *      Stops the timer and records the zone on the calling thread.
+     * Input(s):
+     *      None
+     * Output:
+     *      None (destructor).
+     */
+    ~ECE_ProfileZone();
+
+    ECE_ProfileZone(const ECE_ProfileZone&) = delete;
+    ECE_ProfileZone& operator=(const ECE_ProfileZone&) = delete;
+
+private:
+    const ECE_ProfileSite&                m_site;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+/*
+ * Class: ECE_Profiler
+ * Purpose: Export of everything the zones recorded.
+ * Notes:
+ *      Call the exports when other threads are idle (e.g. at exit); a thread
+ *      that is still recording may overwrite events being read.
+ */
+class ECE_Profiler
+{
+public:
+    /*
+     * Purpose:
+     *      Writes every thread's ring as Chrome trace-event JSON ("X" events).
+     * Input(s):
+     *      const std::string& path - output file
+     * Output:
+     *      bool - false if the file could not be written
+     */
+    static bool writeChromeTrace(const std::string& path);
+
+    /*
+     * Purpose:
+     *      Prints calls, total, mean and max time per zone over the whole
+     *      run (all threads), heaviest zone first.
+     * Input(s):
+     *      std::ostream& out - destination (e.g. std::cout)
+     * Output:
+     *      None
+     */
+    static void writeSummary(std::ostream& out);
+
+    /*
+     * Purpose:
+     *      End-of-run report: writes the trace file and prints the summary
+     *      to std::cout. Used through BUZZY_PROFILE_REPORT.
+     * Input(s):
+     *      const std::string& tracePath - Chrome trace output file
+     * Output:
+     *      None
+     */
+    static void report(const std::string& tracePath);
+};
+
+#define BUZZY_PROFILE_CONCAT2(a, b) a##b
+#define BUZZY_PROFILE_CONCAT(a, b)  BUZZY_PROFILE_CONCAT2(a, b)
+#define BUZZY_PROFILE_ZONE(name)                                                                   \
+    static const ECE_ProfileSite BUZZY_PROFILE_CONCAT(buzzyProfileSite_, __LINE__)(name);          \
+    const ECE_ProfileZone BUZZY_PROFILE_CONCAT(buzzyProfileZone_, __LINE__)(BUZZY_PROFILE_CONCAT(buzzyProfileSite_, __LINE__))
+#define BUZZY_PROFILE_REPORT(tracePath) ECE_Profiler::report(tracePath)
+
+#else
+
+#define BUZZY_PROFILE_ZONE(name) ((void)0)
+#define BUZZY_PROFILE_REPORT(tracePath) ((void)0)
+
+#endif
@@ -0,0 +1,97 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_SnapshotExchange class. The three buffer
+roles (writing, pending, reading) are plain indices guarded by one mutex;
+the lock is only held to change roles, never while a snapshot is filled or
+drawn.
+*/
+
+#include "ECE_RenderSnapshot.h" // Class declaration and interface
+
+/*
+ * Purpose:
+ *      Gets a buffer to fill with the next frame (writer side).
+ * Input(s):
+ *      None
+ * Output:
+ *      RenderSnapshot* - buffer to fill, or nullptr once closed
+ */
+RenderSnapshot* ECE_SnapshotExchange::beginWrite()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_changed.wait(lock, [this] { return m_closed || m_pending == kNone; });
+    if (m_closed)
+    {
+        return nullptr;
+    }
+    m_writing = (m_reading == 0) ? 1 : 0;      // whichever buffer the reader is not drawing
+    return &m_buffers[m_writing];
+}
+
+/*
+ * Purpose:
+ *      Hands the buffer from beginWrite() to the reader.
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_SnapshotExchange::publish()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_writing == kNone)
+        {
+            return;
+        }
+        m_buffers[m_writing].frame = ++m_frames;
+        m_pending = m_writing;
+        m_writing = kNone;
+    }
+    m_changed.notify_all();
+}
+
+/*
+ * Purpose:
+ *      Releases the snapshot drawn last and waits for a newer one.
+ * Input(s):
+ *      None
+ * Output:
+ *      const RenderSnapshot* - snapshot to draw, or nullptr once closed
+ */
+const RenderSnapshot* ECE_SnapshotExchange::acquire()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_reading = kNone;
+    m_changed.wait(lock, [this] { return m_closed || m_pending != kNone; });
+    if (m_closed)
+    {
+        return nullptr;
+    }
+    const int taken = m_pending;
+    m_reading = taken;
+    m_pending = kNone;
+    lock.unlock();
+    m_changed.notify_all();                     // the writer may hand out the next buffer
+    return &m_buffers[taken];
+}
+
+/*
+ * Purpose:
+ *      Wakes both sides and makes every later call return nullptr.
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_SnapshotExchange::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+    }
+    m_changed.notify_all();
+}
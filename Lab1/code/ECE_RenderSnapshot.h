@@ -0,0 +1,124 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for RenderSnapshot and the ECE_SnapshotExchange class. A
+snapshot is everything the renderer needs to draw one gameplay frame: the
+interpolated position, size and sprite id of every visible entity. The
+simulation thread fills one snapshot while the render thread draws the
+other, so neither ever reads state the other is changing.
+*/
+
+#pragma once
+
+#include <SFML/System/Vector2.hpp>  // sf::Vector2f for positions and sizes
+#include <condition_variable>       // std::condition_variable for the hand-off
+#include <cstddef>                  // std::size_t for counts
+#include <cstdint>                  // std::uint16_t / std::uint64_t for ids
+#include <mutex>                    // std::mutex guarding the buffer states
+#include <vector>                   // std::vector for the sprite lists
+
+// using namespace for readability
+using namespace sf;
+
+/*
+ * Purpose:
+ *      One quad to draw.
+ * Fields:
+ *      position    - center in pixels (already interpolated between ticks)
+ *      halfExtents - half width/height in pixels
+ *      sprite      - front-end sprite id (index into its atlas table)
+ */
+struct SpriteInstance
+{
+    Vector2f      position;
+    Vector2f      halfExtents;
+    std::uint16_t sprite = 0;
+};
+
+/*
+ * Purpose:
+ *      Immutable (once published) picture of one gameplay frame.
+ * Fields:
+ *      sprites - quads in draw order
+ *      frame   - sequence number assigned by publish()
+ */
+struct RenderSnapshot
+{
+    std::vector<SpriteInstance> sprites;
+    std::uint64_t               frame = 0;
+};
+
+/*
+ * Class: ECE_SnapshotExchange
+ * Purpose: Double buffer handing snapshots from the simulation thread to
+ *          the render thread.
+ * Notes:
+ *      The writer fills the buffer the reader is not drawing. A new buffer
+ *      is only handed out once the reader has taken the last published
+ *      one, so the simulation runs at most one frame ahead of the screen
+ *      and is paced by the renderer. Buffers are reused, so their sprite
+ *      vectors stop allocating after the first few frames.
+ */
+class ECE_SnapshotExchange
+{
+public:
+    /*
+     * Purpose:
+     *      Gets a buffer to fill with the next frame (writer side).
+     * Input(s):
+     *      None
+     * Output:
+     *      RenderSnapshot* - buffer to fill and then publish(), or nullptr
+     *                        once close() was called
+     * Notes:
+     *      Blocks while the previously published snapshot is still waiting
+     *      for the reader.
+     */
+    RenderSnapshot* beginWrite();
+
+    /*
+     * Purpose:
+     *      Hands the buffer from beginWrite() to the reader.
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void publish();
+
+    /*
+     * Purpose:
+     *      Releases the snapshot drawn last and waits for a newer one
+     *      (reader side).
+     * Input(s):
+     *      None
+     * Output:
+     *      const RenderSnapshot* - snapshot to draw, or nullptr once close()
+     *                              was called
+     */
+    const RenderSnapshot* acquire();
+
+    /*
+     * Purpose:
+     *      Wakes both sides and makes every later call return nullptr.
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void close();
+
+private:
+    static constexpr int kNone = -1;
+
+    RenderSnapshot          m_buffers[2];
+    std::mutex              m_mutex;
+    std::condition_variable m_changed;          // a buffer was published, released, or closed
+    int                     m_writing = kNone;  // buffer the writer is filling
+    int                     m_pending = kNone;  // published, not yet taken by the reader
+    int                     m_reading = kNone;  // buffer the reader is drawing
+    std::uint64_t           m_frames  = 0;
+    bool                    m_closed  = false;
+};
@@ -0,0 +1,313 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_Replay class: run-length recording, varint
+encoding, and sequential playback.
+*/
+
+#include "ECE_Replay.h"         // Class declaration and interface
+#include <cstring>              // std::memcpy for float <-> bits
+#include <fstream>              // std::ifstream / std::ofstream for replay files
+#include <iterator>             // std::istreambuf_iterator to slurp the file
+#include <utility>              // std::move for the decoded runs
+
+static const char         kMagic[4] = {'B', 'Z', 'R', 'P'};
+static const std::uint8_t kVersion  = 3;                  // 2: swept collisions, 3: earliest shot wins contested enemies
+
+// ---------------------------- Encoding ----------------------------
+
+/*
+ * Purpose:
+ *      Appends an unsigned LEB128 varint (7 bits per byte, high bit = more).
+ * Input(s):
+ *      std::vector<std::uint8_t>& out - byte buffer
+ *      std::uint64_t value            - value to encode
+ * Output:
+ *      None
+ */
+static void putVarint(std::vector<std::uint8_t>& out, std::uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+/*
+ * Purpose:
+ *      Reads an unsigned LEB128 varint.
+ * Input(s):
+ *      const std::vector<std::uint8_t>& in - byte buffer
+ *      std::size_t& pos                    - read cursor (advanced)
+ *      std::uint64_t& value                - receives the value
+ * Output:
+ *      bool - false on truncated or over-long input
+ */
+static bool getVarint(const std::vector<std::uint8_t>& in, std::size_t& pos, std::uint64_t& value)
+{
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (pos >= in.size())
+        {
+            return false;
+        }
+        const std::uint8_t byte = in[pos++];
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Purpose:
+ *      Packs an InputFrame into a 3-bit mask.
+ * Input(s):
+ *      const InputFrame& input - input to pack
+ * Output:
+ *      std::uint8_t - bit 0 left, bit 1 right, bit 2 fire
+ */
+static std::uint8_t toMask(const InputFrame& input)
+{
+    return static_cast<std::uint8_t>((input.left ? 1 : 0) | (input.right ? 2 : 0) | (input.fire ? 4 : 0));
+}
+
+// ---------------------------- Recording ----------------------------
+
+/*
+ * Purpose:
+ *      Starts a new recording, discarding any previous one.
+ * Input(s):
+ *      const GameConfig& config - config the round is played with
+ * Output:
+ *      None
+ */
+void ECE_Replay::begin(const GameConfig& config)
+{
+    m_config = GameConfig();
+    m_config.seed          = config.seed;
+    m_config.tickRate      = config.tickRate;
+    m_config.windowSize    = config.windowSize;
+    m_config.buzzyTexSize  = config.buzzyTexSize;
+    m_config.laserTexSize  = config.laserTexSize;
+    m_config.enemy1TexSize = config.enemy1TexSize;
+    m_config.enemy2TexSize = config.enemy2TexSize;
+
+    m_runs.clear();
+    m_ticks  = 0;
+    m_result = StepResult::Running;
+    rewind();
+}
+
+/*
+ * Purpose:
+ *      Appends the input used for one tick.
+ * Input(s):
+ *      const InputFrame& input - input passed to GameState::step
+ * Output:
+ *      None
+ */
+void ECE_Replay::record(const InputFrame& input)
+{
+    const std::uint8_t mask = toMask(input);
+    if (!m_runs.empty() && m_runs.back().mask == mask && m_runs.back().length < UINT32_MAX)
+    { // same input as last tick: extend the run
+        ++m_runs.back().length;
+    }
+    else
+    {
+        m_runs.push_back({mask, 1});
+    }
+    ++m_ticks;
+}
+
+/*
+ * Purpose:
+ *      Stores how the recorded round ended.
+ * Input(s):
+ *      StepResult result - Win, Lose, or Running if the player quit
+ * Output:
+ *      None
+ */
+void ECE_Replay::finish(StepResult result)
+    {
+        m_result = result;
+    }
+
+// ------------------------------ Files ------------------------------
+
+/*
+ * Purpose:
+ *      Writes the replay in the compact binary format.
+ * Input(s):
+ *      const std::string& path - output file
+ * Output:
+ *      bool - false if the file could not be written
+ */
+bool ECE_Replay::saveToFile(const std::string& path) const
+{
+    std::vector<std::uint8_t> out(kMagic, kMagic + 4);
+    out.push_back(kVersion);
+    putVarint(out, m_config.seed);
+
+    std::uint32_t rateBits;
+    std::memcpy(&rateBits, &m_config.tickRate, sizeof rateBits);
+    for (int b = 0; b < 4; ++b)
+    { // little-endian regardless of host
+        out.push_back(static_cast<std::uint8_t>(rateBits >> (8 * b)));
+    }
+
+    for (const Vector2u& v : {m_config.windowSize, m_config.buzzyTexSize, m_config.laserTexSize,
+                              m_config.enemy1TexSize, m_config.enemy2TexSize})
+    {
+        putVarint(out, v.x);
+        putVarint(out, v.y);
+    }
+
+    out.push_back(static_cast<std::uint8_t>(m_result));
+    putVarint(out, m_ticks);
+    putVarint(out, m_runs.size());
+    for (const Run& run : m_runs)
+    {
+        putVarint(out, (static_cast<std::uint64_t>(run.length - 1) << 3) | run.mask);
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(out.data()), static_cast<std::streamsize>(out.size()));
+    return file.good();
+}
+
+/*
+ * Purpose:
+ *      Reads a replay written by saveToFile and rewinds playback.
+ * Input(s):
+ *      const std::string& path - replay file
+ * Output:
+ *      bool - false if the file is missing, truncated, or a different
+ *             format version
+ */
+bool ECE_Replay::loadFromFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+    const std::vector<std::uint8_t> in((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    if (in.size() < 10 || std::memcmp(in.data(), kMagic, 4) != 0 || in[4] != kVersion)
+    { // not a replay, or written by an incompatible build
+        return false;
+    }
+    std::size_t pos = 5;
+    std::uint64_t v = 0;
+
+    GameConfig config;
+    if (!getVarint(in, pos, v)) { return false; }
+    config.seed = static_cast<std::uint32_t>(v);
+
+    if (pos + 4 > in.size()) { return false; }
+    std::uint32_t rateBits = 0;
+    for (int b = 0; b < 4; ++b)
+    {
+        rateBits |= static_cast<std::uint32_t>(in[pos++]) << (8 * b);
+    }
+    std::memcpy(&config.tickRate, &rateBits, sizeof rateBits);
+
+    for (Vector2u* size : {&config.windowSize, &config.buzzyTexSize, &config.laserTexSize,
+                           &config.enemy1TexSize, &config.enemy2TexSize})
+    {
+        std::uint64_t x = 0, y = 0;
+        if (!getVarint(in, pos, x) || !getVarint(in, pos, y)) { return false; }
+        *size = Vector2u(static_cast<unsigned int>(x), static_cast<unsigned int>(y));
+    }
+
+    if (pos >= in.size() || in[pos] > static_cast<std::uint8_t>(StepResult::Lose)) { return false; }
+    const StepResult result = static_cast<StepResult>(in[pos++]);
+
+    std::uint64_t ticks = 0, runCount = 0;
+    if (!getVarint(in, pos, ticks) || !getVarint(in, pos, runCount)) { return false; }
+    if (runCount > in.size() - pos) { return false; }  // every run takes at least one byte
+
+    std::vector<Run> runs;
+    runs.reserve(static_cast<std::size_t>(runCount));
+    std::uint64_t total = 0;
+    for (std::uint64_t r = 0; r < runCount; ++r)
+    {
+        if (!getVarint(in, pos, v) || (v >> 3) >= UINT32_MAX) { return false; }
+        runs.push_back({static_cast<std::uint8_t>(v & 7), static_cast<std::uint32_t>((v >> 3) + 1)});
+        total += runs.back().length;
+    }
+    if (total != ticks) { return false; }                 // header and runs disagree: corrupt file
+
+    m_config = config;
+    m_runs   = std::move(runs);
+    m_ticks  = static_cast<std::size_t>(ticks);
+    m_result = result;
+    rewind();
+    return true;
+}
+
+// ----------------------------- Playback -----------------------------
+
+/*
+ * Purpose:
+ *      Default GameConfig with the recorded seed, tick rate and sizes.
+ * Input(s):
+ *      None
+ * Output:
+ *      GameConfig - config to construct the replayed GameState with
+ */
+GameConfig ECE_Replay::makeConfig() const
+    {
+        return m_config;
+    }
+
+/*
+ * Purpose:
+ *      Moves playback back to the first tick.
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_Replay::rewind()
+{
+    m_playRun  = 0;
+    m_playTick = 0;
+}
+
+/*
+ * Purpose:
+ *      Input for the next tick of playback.
+ * Input(s):
+ *      InputFrame& input - receives the input
+ * Output:
+ *      bool - false once every recorded tick has been played
+ */
+bool ECE_Replay::next(InputFrame& input)
+{
+    if (m_playRun < m_runs.size() && m_playTick == m_runs[m_playRun].length)
+    { // current run used up
+        ++m_playRun;
+        m_playTick = 0;
+    }
+    if (m_playRun >= m_runs.size())
+    {
+        return false;
+    }
+
+    const std::uint8_t mask = m_runs[m_playRun].mask;
+    input.left  = (mask & 1) != 0;
+    input.right = (mask & 2) != 0;
+    input.fire  = (mask & 4) != 0;
+    ++m_playTick;
+    return true;
+}
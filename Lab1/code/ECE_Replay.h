@@ -0,0 +1,145 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the ECE_Replay class. A replay is everything needed to
+re-run one round of GameState bit for bit: the RNG seed, the fixed tick
+rate, the playfield/sprite sizes, and the InputFrame fed to every tick.
+Inputs are stored as a 3-bit mask per tick, run-length encoded, and each
+run is written as a single LEB128 varint, so a held key or an idle stretch
+costs one or two bytes however long it lasts.
+
+File layout (little-endian):
+    "BZRP"  magic
+    u8      format version
+    varint  seed
+    u32     tick rate (IEEE-754 float bits)
+    varint  window width, window height
+    varint  buzzy/laser/enemy1/enemy2 texture sizes (x, y each)
+    u8      recorded StepResult
+    varint  tick count
+    varint  run count, then per run: varint ((length - 1) << 3 | mask)
+*/
+
+#pragma once
+
+#include <cstddef>              // std::size_t for counts
+#include <cstdint>              // std::uint8_t / std::uint32_t for the packed format
+#include <string>               // std::string for file paths
+#include <vector>               // std::vector for the input runs
+
+#include "GameState.h"          // GameConfig, InputFrame, StepResult
+
+/*
+ * Class: ECE_Replay
+ * Purpose: Records a round's inputs and plays them back tick by tick.
+ * Notes:
+ *      Only the values written by begin() come from the recording; every
+ *      other GameConfig field must match the defaults (the format version
+ *      is bumped whenever a default that affects gameplay changes).
+ */
+class ECE_Replay
+{
+public:
+    /*
+     * Purpose:
+     *      Starts a new recording, discarding any previous one.
+     * Input(s):
+     *      const GameConfig& config - config the round is played with (seed,
+     *                                 tick rate and sizes are captured)
+     * Output:
+     *      None
+     */
+    void begin(const GameConfig& config);
+
+    /*
+     * Purpose:
+     *      Appends the input used for one tick.
+     * Input(s):
+     *      const InputFrame& input - input passed to GameState::step
+     * Output:
+     *      None
+     */
+    void record(const InputFrame& input);
+
+    /*
+     * Purpose:
+     *      Stores how the recorded round ended.
+     * Input(s):
+     *      StepResult result - Win, Lose, or Running if the player quit
+     * Output:
+     *      None
+     */
+    void finish(StepResult result);
+
+    /*
+     * Purpose:
+     *      Writes the replay in the compact binary format.
+     * Input(s):
+     *      const std::string& path - output file
+     * Output:
+     *      bool - false if the file could not be written
+     */
+    bool saveToFile(const std::string& path) const;
+
+    /*
+     * Purpose:
+     *      Reads a replay written by saveToFile and rewinds playback.
+     * Input(s):
+     *      const std::string& path - replay file
+     * Output:
+     *      bool - false if the file is missing, truncated, or a different
+     *             format version
+     */
+    bool loadFromFile(const std::string& path);
+
+    /*
+     * Purpose:
+     *      Default GameConfig with the recorded seed, tick rate and sizes.
+     * Input(s):
+     *      None
+     * Output:
+     *      GameConfig - config to construct the replayed GameState with
+     */
+    GameConfig makeConfig() const;
+
+    /*
+     * Purpose:
+     *      Moves playback back to the first tick.
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void rewind();
+
+    /*
+     * Purpose:
+     *      Input for the next tick of playback.
+     * Input(s):
+     *      InputFrame& input - receives the input
+     * Output:
+     *      bool - false once every recorded tick has been played
+     */
+    bool next(InputFrame& input);
+
+    std::size_t tickCount() const { return m_ticks; }     // ticks recorded
+    std::size_t runCount()  const { return m_runs.size(); }
+    StepResult  result()    const { return m_result; }    // how the recorded round ended
+
+private:
+    struct Run
+    {
+        std::uint8_t  mask;     // bit 0 left, bit 1 right, bit 2 fire
+        std::uint32_t length;   // consecutive ticks with this mask
+    };
+
+    GameConfig       m_config;                          // recorded fields only (see begin)
+    std::vector<Run> m_runs;
+    std::size_t      m_ticks  = 0;
+    StepResult       m_result = StepResult::Running;
+
+    std::size_t   m_playRun  = 0;                       // playback cursor: current run
+    std::uint32_t m_playTick = 0;                       // ticks already played from it
+};
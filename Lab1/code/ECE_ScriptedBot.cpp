@@ -0,0 +1,38 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_ScriptedBot class.
+*/
+
+#include "ECE_ScriptedBot.h"    // Class declaration and interface
+
+/*
+ * Purpose:
+ *      Scripted player: sweeps left/right and fires on a fixed cadence.
+ * Input(s):
+ *      long tick                - current tick within the round
+ *      const GameState& state   - round being played (for Buzzy's position)
+ * Output:
+ *      InputFrame - input for this tick.
+ */
+InputFrame ECE_ScriptedBot::next(long tick, const GameState& state)
+{
+    const float x     = state.buzzy().getPosition().x;
+    const float width = static_cast<float>(state.config().windowSize.x);
+    if (x < width * 0.1f)
+    { // near left wall, sweep right
+        m_dir = +1;
+    }
+    else if (x > width * 0.9f)
+    { // near right wall, sweep left
+        m_dir = -1;
+    }
+
+    InputFrame input;
+    input.left  = (m_dir < 0);
+    input.right = (m_dir > 0);
+    input.fire  = (tick % 15 == 0);     // roughly 8 shots per second at 120 Hz
+    return input;
+}
@@ -0,0 +1,35 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the ECE_ScriptedBot class: a deterministic stand-in player
+for display-less runs (buzzy_headless, buzzy_sweep). It sweeps Buzzy from
+wall to wall and fires on a fixed cadence.
+*/
+
+#pragma once
+
+#include "GameState.h"          // GameState, InputFrame
+
+/*
+ * Class: ECE_ScriptedBot
+ * Purpose: Produces one InputFrame per tick from the current round state.
+ */
+class ECE_ScriptedBot
+{
+public:
+    /*
+     * Purpose:
+     *      Input for the given tick.
+     * Input(s):
+     *      long tick                - current tick within the round
+     *      const GameState& state   - round being played (for Buzzy's position)
+     * Output:
+     *      InputFrame - input for this tick.
+     */
+    InputFrame next(long tick, const GameState& state);
+
+private:
+    int m_dir = +1;     // sweep direction (+1 right, -1 left); flipped at the edges
+};
@@ -0,0 +1,189 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_ShotResolver class. A claim packs the time
+of first contact (a non-negative float, whose bit pattern orders like the
+value) above the shot slot, so an atomic minimum over the packed value
+picks the earliest shot and breaks ties by slot.
+*/
+
+#include "ECE_ShotResolver.h"   // Class declaration and interface
+#include "ECE_Components.h"     // sweptBounds / sweptOverlap
+#include "ECE_Profiler.h"       // BUZZY_PROFILE_ZONE phase timer
+#include <algorithm>            // std::min / std::max for task sizing
+#include <cstring>              // std::memcpy for float bits
+
+static const std::size_t kParallelMinShots = 512;  // below this the pool is not used
+static const std::size_t kShotsPerTask     = 128;  // smallest slice handed to a worker
+
+/*
+ * Purpose:
+ *      Finds which enemy (if any) each shot kills this tick.
+ * Input(s):
+ *      const ECE_LaserPool& shots       - player lasers
+ *      const ECE_EnemySwarm& enemies    - swarm (not modified)
+ *      const ECE_UniformGrid& grid      - broadphase built from the swarm this tick
+ *      ECE_ThreadPool* pool             - workers for the search (nullptr = this thread)
+ * Output:
+ *      None
+ */
+void ECE_ShotResolver::resolve(const ECE_LaserPool& shots,
+                               const ECE_EnemySwarm& enemies,
+                               const ECE_UniformGrid& grid,
+                               ECE_ThreadPool* pool)
+{
+    BUZZY_PROFILE_ZONE("resolveShots");
+    const std::size_t nShots   = shots.size();
+    const std::size_t nEnemies = enemies.size();
+
+    if (m_claims.size() < nEnemies)
+    { // atomics cannot be moved, so grow by building a new array
+        m_claims = std::vector<std::atomic<std::uint64_t>>(nEnemies);
+    }
+    for (std::size_t i = 0; i < nEnemies; ++i)
+    {
+        m_claims[i].store(kUnclaimed, std::memory_order_relaxed);
+    }
+    m_taken.assign(nEnemies, 0);
+    m_target.assign(nShots, kNoTarget);
+    m_key.resize(nShots);
+
+    m_active.resize(nShots);
+    for (std::size_t s = 0; s < nShots; ++s)
+    {
+        m_active[s] = static_cast<std::uint32_t>(s);
+    }
+
+    m_hits   = 0;
+    m_rounds = 0;
+    while (!m_active.empty())
+    {
+        ++m_rounds;
+        const std::size_t n = m_active.size();
+        if (pool && n >= kParallelMinShots)
+        { // one slice per task; pool.wait() is the barrier before claims are read
+            const std::size_t tasks = std::min(pool->threadCount() * 4, (n + kShotsPerTask - 1) / kShotsPerTask);
+            const std::size_t slice = (n + tasks - 1) / tasks;
+            for (std::size_t begin = 0; begin < n; begin += slice)
+            {
+                const std::size_t end = std::min(n, begin + slice);
+                pool->submit([this, begin, end, &shots, &enemies, &grid] { search(begin, end, shots, enemies, grid); });
+            }
+            pool->wait();
+        }
+        else
+        {
+            search(0, n, shots, enemies, grid);
+        }
+
+        // Settle the round: the smallest claim on each enemy wins, everyone else retries
+        m_retry.clear();
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            const std::uint32_t s = m_active[k];
+            const std::uint32_t i = m_target[s];
+            if (i == kNoTarget)
+            { // nothing left in reach: a miss
+                continue;
+            }
+            if (m_claims[i].load(std::memory_order_relaxed) == m_key[s])
+            {
+                m_taken[i] = 1;
+                ++m_hits;
+            }
+            else
+            {
+                m_target[s] = kNoTarget;
+                m_retry.push_back(s);
+            }
+        }
+        m_active.swap(m_retry);
+    }
+}
+
+/*
+ * Purpose:
+ *      Search phase for a slice of the active shots.
+ * Input(s):
+ *      std::size_t begin, end - range of m_active to process
+ *      (shots, enemies, grid as in resolve)
+ * Output:
+ *      None
+ * Notes:
+ *      Reads m_taken (only written between rounds) and writes m_target /
+ *      m_key for its own shots, so slices share nothing but the claims.
+ */
+void ECE_ShotResolver::search(std::size_t begin, std::size_t end,
+                              const ECE_LaserPool& shots,
+                              const ECE_EnemySwarm& enemies,
+                              const ECE_UniformGrid& grid)
+{
+    const Vector2f shotHalf = shots.getHalfExtents();
+    for (std::size_t k = begin; k < end; ++k)
+    {
+        const std::uint32_t s    = m_active[k];
+        const Vector2f      from = shots.getPreviousPosition(s);
+        const Vector2f      to   = shots.getPosition(s);
+
+        std::size_t hit = enemies.size();
+        float hitTime = 2.f;                            // time of first contact of 'hit' (> 1 = none)
+        grid.query(sweptBounds(from, to, shotHalf), [&](std::size_t i)
+        { // candidate enemies from overlapped cells (may repeat)
+            float t;
+            if (enemies.isAlive(i) && !m_taken[i] &&
+                sweptOverlap(from, to, shotHalf,
+                             enemies.getPreviousPosition(i), enemies.getPosition(i), enemies.getHalfExtents(i), t) &&
+                (t < hitTime || (t == hitTime && i < hit)))
+            {
+                hit     = i;
+                hitTime = t;
+            }
+        });
+        if (hit == enemies.size())
+        {
+            continue;
+        }
+
+        std::uint32_t timeBits;
+        std::memcpy(&timeBits, &hitTime, sizeof(timeBits));
+        const std::uint64_t key = (static_cast<std::uint64_t>(timeBits) << 32) | s;
+        m_target[s] = static_cast<std::uint32_t>(hit);
+        m_key[s]    = key;
+
+        std::atomic<std::uint64_t>& claim = m_claims[hit];
+        std::uint64_t current = claim.load(std::memory_order_relaxed);
+        while (key < current && !claim.compare_exchange_weak(current, key, std::memory_order_relaxed))
+        { // another shot claimed it meanwhile; current now holds its key, retry only if ours is still smaller
+        }
+    }
+}
+
+/*
+ * Purpose:
+ *      Kills every claimed enemy and despawns the shots that hit.
+ * Input(s):
+ *      ECE_LaserPool& shots     - the pool passed to resolve()
+ *      ECE_EnemySwarm& enemies  - the swarm passed to resolve()
+ * Output:
+ *      None
+ */
+void ECE_ShotResolver::apply(ECE_LaserPool& shots, ECE_EnemySwarm& enemies)
+{
+    for (std::size_t shot = 0; shot < shots.size();)
+    { // loops through all shots in player shots pool
+        const std::uint32_t hit = m_target[shot];
+        if (hit != kNoTarget)
+        { // kills enemy if the current player shot won it
+            enemies.kill(hit);
+            const std::size_t last = shots.size() - 1;
+            m_target[shot] = m_target[last];                                        // follow the swap-remove below
+            shots.despawn(shot);                                                    // slot 'shot' now holds the next shot to test
+        }
+        else
+        { // move on to the next shot in the player shots pool
+            shot++;
+        }
+    }
+}
@@ -0,0 +1,103 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the ECE_ShotResolver class. Resolves player shots against
+the enemy swarm in two phases so the search can run on several threads:
+first every shot looks for its target independently and claims it with an
+atomic compare-exchange, then the winning hits are applied to the swarm
+and the shot pool on one thread in a fixed order.
+*/
+
+#pragma once
+
+#include <atomic>                   // std::atomic for the per-enemy claims
+#include <cstddef>                  // std::size_t for indices
+#include <cstdint>                  // std::uint32_t / std::uint64_t for packed claims
+#include <vector>                   // std::vector for the scratch arrays
+
+#include "ECE_EnemySwarm.h"         // Structure-of-arrays enemy formation
+#include "ECE_LaserPool.h"          // Dense swap-remove laser pool
+#include "ECE_ThreadPool.h"         // Work-stealing pool for the search phase
+#include "ECE_UniformGrid.h"        // Broadphase grid over the swarm
+
+/*
+ * Class: ECE_ShotResolver
+ * Purpose: Parallel shot-vs-enemy collision search with deterministic
+ *          results.
+ * Notes:
+ *      Each enemy's claim holds the smallest (time of first contact, shot
+ *      slot) pair that targeted it, so the shot that reaches an enemy first
+ *      kills it however the threads were scheduled. Shots that lose a claim
+ *      search again, ignoring enemies already taken, until no shot finds a
+ *      new target. Thread count therefore never changes the outcome.
+ */
+class ECE_ShotResolver
+{
+public:
+    /*
+     * Purpose:
+     *      Finds which enemy (if any) each shot kills this tick.
+     * Input(s):
+     *      const ECE_LaserPool& shots       - player lasers
+     *      const ECE_EnemySwarm& enemies    - swarm (not modified)
+     *      const ECE_UniformGrid& grid      - broadphase built from the swarm this tick
+     *      ECE_ThreadPool* pool             - workers for the search (nullptr = this thread)
+     * Output:
+     *      None
+     * Notes:
+     *      Small shot counts are searched on the calling thread even when a
+     *      pool is given; the dispatch would cost more than the search.
+     */
+    void resolve(const ECE_LaserPool& shots,
+                 const ECE_EnemySwarm& enemies,
+                 const ECE_UniformGrid& grid,
+                 ECE_ThreadPool* pool);
+
+    /*
+     * Purpose:
+     *      Kills every claimed enemy and despawns the shots that hit.
+     * Input(s):
+     *      ECE_LaserPool& shots     - the pool passed to resolve()
+     *      ECE_EnemySwarm& enemies  - the swarm passed to resolve()
+     * Output:
+     *      None
+     * Notes:
+     *      Walks the pool in slot order with the pool's swap-remove, the
+     *      same order the single-pass loop used, so kill order and the
+     *      resulting slot layout do not depend on the search.
+     */
+    void apply(ECE_LaserPool& shots, ECE_EnemySwarm& enemies);
+
+    std::size_t hitCount()   const { return m_hits; }     // kills found by the last resolve()
+    std::size_t roundCount() const { return m_rounds; }   // search rounds the last resolve() needed
+
+private:
+    static constexpr std::uint32_t kNoTarget  = 0xFFFFFFFFu;
+    static constexpr std::uint64_t kUnclaimed = ~static_cast<std::uint64_t>(0);
+
+    /*
+     * Purpose:
+     *      Search phase for shots m_active[begin, end): picks each shot's
+     *      first-contact enemy among those not taken and claims it.
+     * Input(s):
+     *      std::size_t begin, end - range of m_active to process
+     *      (shots, enemies, grid as in resolve)
+     * Output:
+     *      None
+     */
+    void search(std::size_t begin, std::size_t end,
+                const ECE_LaserPool& shots,
+                const ECE_EnemySwarm& enemies,
+                const ECE_UniformGrid& grid);
+
+    std::vector<std::atomic<std::uint64_t>> m_claims;   // per enemy: best (toi bits << 32 | shot) so far
+    std::vector<std::uint8_t>  m_taken;                 // per enemy: won by some shot this tick
+    std::vector<std::uint32_t> m_target;                // per shot slot: enemy it kills (or is trying to)
+    std::vector<std::uint64_t> m_key;                   // per shot slot: its claim value for m_target
+    std::vector<std::uint32_t> m_active;                // shots still searching this round
+    std::vector<std::uint32_t> m_retry;                 // shots that lost a claim (next round)
+    std::size_t m_hits   = 0;
+    std::size_t m_rounds = 0;
+};
@@ -0,0 +1,102 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_SpriteBatch class.
+*/
+
+#include "ECE_SpriteBatch.h"    // Class declaration and interface
+#include <utility>              // std::swap to reorder reused buckets
+
+/*
+ * Purpose:
+ *      Starts a new frame: empties every bucket (keeping its storage).
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_SpriteBatch::begin()
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.vertices.clear();        // keeps capacity
+    }
+    m_active = 0;
+    m_quads  = 0;
+}
+
+/*
+ * Purpose:
+ *      Queues one quad.
+ * Input(s):
+ *      const Texture& texture - texture the quad samples
+ *      Vector2f center        - quad center in pixels
+ *      Vector2f halfSize      - half width/height in pixels
+ *      const IntRect& texRect - source rectangle in texture pixels
+ * Output:
+ *      None
+ */
+void ECE_SpriteBatch::add(const Texture& texture, Vector2f center, Vector2f halfSize, const IntRect& texRect)
+{
+    std::size_t b = 0;
+    while (b < m_active && m_buckets[b].texture != &texture)
+    { // a frame only uses a handful of textures, so a linear search is cheapest
+        ++b;
+    }
+
+    if (b == m_active)
+    { // first quad with this texture this frame: claim the next bucket
+        if (m_active == m_buckets.size())
+        {
+            m_buckets.emplace_back();
+        }
+        for (std::size_t k = m_active; k < m_buckets.size(); ++k)
+        { // prefer a spare bucket that already served this texture (its storage fits)
+            if (m_buckets[k].texture == &texture)
+            {
+                std::swap(m_buckets[k], m_buckets[m_active]);
+                break;
+            }
+        }
+        m_buckets[m_active].texture = &texture;
+        ++m_active;
+    }
+
+    const float l = center.x - halfSize.x, r = center.x + halfSize.x;
+    const float t = center.y - halfSize.y, btm = center.y + halfSize.y;
+    const float u0 = static_cast<float>(texRect.left);
+    const float v0 = static_cast<float>(texRect.top);
+    const float u1 = static_cast<float>(texRect.left + texRect.width);
+    const float v1 = static_cast<float>(texRect.top  + texRect.height);
+
+    VertexArray& va = m_buckets[b].vertices;
+    va.append(Vertex({l, t},   {u0, v0}));
+    va.append(Vertex({r, t},   {u1, v0}));
+    va.append(Vertex({r, btm}, {u1, v1}));
+    va.append(Vertex({l, btm}, {u0, v1}));
+    ++m_quads;
+}
+
+/*
+ * Purpose:
+ *      Submits each non-empty bucket with one draw call.
+ * Input(s):
+ *      RenderTarget& target - window (or texture) to draw into
+ * Output:
+ *      std::size_t - number of draw calls issued
+ */
+std::size_t ECE_SpriteBatch::flush(RenderTarget& target)
+{
+    std::size_t drawCalls = 0;
+    for (std::size_t b = 0; b < m_active; ++b)
+    {
+        if (m_buckets[b].vertices.getVertexCount() > 0)
+        {
+            target.draw(m_buckets[b].vertices, RenderStates(m_buckets[b].texture));
+            ++drawCalls;
+        }
+    }
+    return drawCalls;
+}
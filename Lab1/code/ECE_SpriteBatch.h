@@ -0,0 +1,77 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the ECE_SpriteBatch class. Collects axis-aligned textured
+quads for one frame into one sf::VertexArray per texture and submits each
+array with a single draw call, instead of one window.draw() per sprite.
+Vertex storage is reused frame to frame, so steady-state frames allocate
+nothing.
+*/
+
+#pragma once
+
+#include <SFML/Graphics.hpp>    // sf::VertexArray, sf::Texture, sf::RenderTarget
+#include <cstddef>              // std::size_t for counters
+#include <vector>               // std::vector for the per-texture buckets
+
+// using namespace for readability
+using namespace sf;
+
+/*
+ * Class: ECE_SpriteBatch
+ * Purpose: Per-texture quad batching with a draw-call counter.
+ * Notes:
+ *      Buckets are flushed in the order their texture was first added in a
+ *      frame, so add background layers before foreground ones.
+ */
+class ECE_SpriteBatch
+{
+public:
+    /*
+     * Purpose:
+     *      Starts a new frame: empties every bucket (keeping its storage).
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void begin();
+
+    /*
+     * Purpose:
+     *      Queues one quad.
+     * Input(s):
+     *      const Texture& texture - texture the quad samples
+     *      Vector2f center        - quad center in pixels
+     *      Vector2f halfSize      - half width/height in pixels
+     *      const IntRect& texRect - source rectangle in texture pixels
+     * Output:
+     *      None
+     */
+    void add(const Texture& texture, Vector2f center, Vector2f halfSize, const IntRect& texRect);
+
+    /*
+     * Purpose:
+     *      Submits each non-empty bucket with one draw call.
+     * Input(s):
+     *      RenderTarget& target - window (or texture) to draw into
+     * Output:
+     *      std::size_t - number of draw calls issued
+     */
+    std::size_t flush(RenderTarget& target);
+
+    std::size_t getQuadCount() const { return m_quads; }    // quads queued since begin()
+
+private:
+    struct Bucket
+    {
+        const Texture* texture = nullptr;
+        VertexArray    vertices{Quads};
+    };
+
+    std::vector<Bucket> m_buckets;      // one per texture seen; reused across frames
+    std::size_t         m_active = 0;   // buckets in use this frame: [0, m_active)
+    std::size_t         m_quads  = 0;
+};
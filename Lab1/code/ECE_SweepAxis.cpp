@@ -0,0 +1,79 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_SweepAxis class. sync() keeps the previous
+tick's order, patches in the pool's spawns and despawns, refreshes the keys
+and insertion-sorts. Shots in one pool move in lockstep, so only newly
+spawned shots and slots refilled by despawn have to travel.
+*/
+
+#include "ECE_SweepAxis.h"      // Class declaration and interface
+#include "ECE_Profiler.h"       // BUZZY_PROFILE_ZONE phase timer
+#include <algorithm>            // std::min / std::max for the swept keys
+#include <cmath>                // std::fabs for the swept height
+
+/*
+ * Purpose:
+ *      Brings the sorted order up to date with the pool's current shots.
+ * Input(s):
+ *      const ECE_LaserPool& shots - pool to track
+ * Output:
+ *      None
+ */
+void ECE_SweepAxis::sync(const ECE_LaserPool& shots)
+{
+    BUZZY_PROFILE_ZONE("sweepSync");
+    const std::size_t n     = shots.size();
+    const float       halfH = shots.getHalfExtents().y;
+
+    // Keep the surviving slots in last tick's order; slots past the live count are gone
+    m_seen.assign(n, 0);
+    std::size_t kept = 0;
+    for (std::size_t k = 0; k < m_order.size(); ++k)
+    {
+        const std::uint32_t slot = m_order[k];
+        if (slot < n)
+        {
+            m_order[kept++] = slot;
+            m_seen[slot]    = 1;
+        }
+    }
+    m_order.resize(kept);
+    for (std::size_t slot = 0; slot < n; ++slot)
+    { // slots filled by spawn() since the last sync
+        if (!m_seen[slot])
+        {
+            m_order.push_back(static_cast<std::uint32_t>(slot));
+        }
+    }
+
+    m_keys.resize(n);
+    m_maxSpan = 2.f * halfH;
+    for (std::size_t k = 0; k < n; ++k)
+    { // top of the box the shot swept this tick
+        const float y     = shots.getPosition(m_order[k]).y;
+        const float prevY = shots.getPreviousPosition(m_order[k]).y;
+        m_keys[k]  = std::min(y, prevY) - halfH;
+        m_maxSpan  = std::max(m_maxSpan, std::fabs(y - prevY) + 2.f * halfH);
+    }
+
+    // Insertion sort: nearly sorted input, so most entries do not move at all
+    m_lastMoves = 0;
+    for (std::size_t k = 1; k < n; ++k)
+    {
+        const float         key  = m_keys[k];
+        const std::uint32_t slot = m_order[k];
+        std::size_t j = k;
+        while (j > 0 && m_keys[j - 1] > key)
+        {
+            m_keys[j]  = m_keys[j - 1];
+            m_order[j] = m_order[j - 1];
+            --j;
+        }
+        m_keys[j]  = key;
+        m_order[j] = slot;
+        m_lastMoves += k - j;
+    }
+}
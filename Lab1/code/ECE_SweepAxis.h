@@ -0,0 +1,89 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the ECE_SweepAxis class. A sweep-and-prune broadphase for a
+laser pool along the vertical axis: shot slots are kept sorted by the top
+edge of their swept hitbox (the box covering the shot's whole last tick), so
+a query for a horizontal band (the player's row) binary-searches to the first
+candidate and stops at the first shot below the band. All shots in a pool
+share one speed and direction, so their order barely changes between ticks
+and the sort is kept up to date with an insertion sort that is close to a
+single linear pass.
+*/
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>   // sf::FloatRect for query boxes
+#include <algorithm>                // std::lower_bound for the band start
+#include <cstddef>                  // std::size_t for indices
+#include <cstdint>                  // std::uint32_t / std::uint8_t for packed arrays
+#include <vector>                   // std::vector for the sorted arrays
+
+#include "ECE_LaserPool.h"          // Dense swap-remove laser pool
+
+// using namespace for readability
+using namespace sf;
+
+/*
+ * Class: ECE_SweepAxis
+ * Purpose: Keeps a laser pool's slots sorted by vertical position so band
+ *          queries only visit shots that can overlap the band.
+ * Notes:
+ *      The pool's swap-remove despawn moves shots between slots; sync()
+ *      drops slots that no longer exist, appends new ones and re-sorts by
+ *      the current positions, so it never needs to know what happened.
+ */
+class ECE_SweepAxis
+{
+public:
+    /*
+     * Purpose:
+     *      Brings the sorted order up to date with the pool's current shots.
+     * Input(s):
+     *      const ECE_LaserPool& shots - pool to track (same pool every call)
+     * Output:
+     *      None
+     * Notes:
+     *      Equal keys keep their previous order (the sort is stable), and
+     *      once the arrays have grown to the pool size nothing allocates.
+     */
+    void sync(const ECE_LaserPool& shots);
+
+    /*
+     * Purpose:
+     *      Calls visit(slot) for every shot whose swept vertical span
+     *      overlaps the box's vertical span, in top-to-bottom order.
+     * Input(s):
+     *      const FloatRect& box - query area in pixels (only top/height used)
+     *      Visit&& visit        - callable taking std::size_t
+     * Output:
+     *      None
+     * Notes:
+     *      Candidates are conservative; callers still run the exact swept test.
+     *      Shots despawned since the last sync() are still visited.
+     */
+    template <typename Visit>
+    void query(const FloatRect& box, Visit&& visit) const
+    {
+        const float bandTop    = box.top - m_maxSpan - 1.f;      // 1 px slack for rounding in the caller's test
+        const float bandBottom = box.top + box.height;
+        const std::size_t first = static_cast<std::size_t>(
+            std::lower_bound(m_keys.begin(), m_keys.end(), bandTop) - m_keys.begin());
+        for (std::size_t k = first; k < m_keys.size() && m_keys[k] < bandBottom; ++k)
+        {
+            visit(static_cast<std::size_t>(m_order[k]));
+        }
+    }
+
+    std::size_t size()      const { return m_order.size(); }   // shots tracked at the last sync
+    std::size_t lastMoves() const { return m_lastMoves; }      // insertion-sort shifts in the last sync
+
+private:
+    std::vector<std::uint32_t> m_order;         // pool slots sorted by swept top edge
+    std::vector<float>         m_keys;          // swept top edge of m_order[k] at the last sync
+    std::vector<std::uint8_t>  m_seen;          // per-slot scratch used while syncing
+    float       m_maxSpan    = 0.f;             // tallest swept hitbox at the last sync
+    std::size_t m_lastMoves  = 0;
+};
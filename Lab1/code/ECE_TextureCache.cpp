@@ -0,0 +1,312 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_TextureCache and ECE_MappedFile classes.
+The source file is always read (cheap) to hash it; only the decode, the
+expensive inflate step, is skipped on a hit. New blobs are written to a
+temporary file and renamed into place, so a crash never leaves a torn blob
+that passes the header check.
+*/
+
+#include "ECE_TextureCache.h"   // Class declarations and interface
+
+#include <cstdint>              // std::uint32_t / std::uint64_t for the blob header
+#include <cstring>              // std::memcmp / std::memcpy for the header
+#include <filesystem>           // std::filesystem for the cache directory and rename
+#include <fstream>              // std::ifstream / std::ofstream for source and blob files
+#include <iterator>             // std::istreambuf_iterator to slurp the source
+#include <utility>              // std::swap for move assignment
+#include <vector>               // std::vector for the source bytes
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>            // CreateFileMapping / MapViewOfFile
+#else
+#include <fcntl.h>              // open
+#include <sys/mman.h>           // mmap / munmap
+#include <sys/stat.h>           // fstat for the file size
+#include <unistd.h>             // close
+#endif
+
+namespace
+{
+    constexpr char          kMagic[4]   = {'B', 'Z', 'T', 'X'};
+    constexpr std::uint32_t kVersion    = 1;
+    constexpr std::uint32_t kFormatRgba8 = 1;
+
+    /*
+     * Purpose:
+     *      Fixed header at the start of every blob; pixels follow directly.
+     */
+    struct BlobHeader
+    {
+        char          magic[4];
+        std::uint32_t version;
+        std::uint32_t width;
+        std::uint32_t height;
+        std::uint32_t format;
+        std::uint32_t reserved;
+        std::uint64_t sourceSize;
+        std::uint64_t sourceHash;
+    };
+    static_assert(sizeof(BlobHeader) % 8 == 0, "pixels must start 8-byte aligned");
+
+    /*
+     * Purpose:
+     *      64-bit FNV-1a hash of a byte range.
+     * Input(s):
+     *      const unsigned char* data, std::size_t n - bytes to hash
+     * Output:
+     *      std::uint64_t - hash value
+     */
+    std::uint64_t fnv1a64(const unsigned char* data, std::size_t n)
+    {
+        std::uint64_t h = 14695981039346656037ull;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            h = (h ^ data[i]) * 1099511628211ull;
+        }
+        return h;
+    }
+}
+
+// ---------------------------- ECE_MappedFile ----------------------------
+
+ECE_MappedFile::ECE_MappedFile(ECE_MappedFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+ECE_MappedFile& ECE_MappedFile::operator=(ECE_MappedFile&& other) noexcept
+{
+    std::swap(m_data, other.m_data);
+    std::swap(m_size, other.m_size);
+#ifdef _WIN32
+    std::swap(m_mapping, other.m_mapping);
+#endif
+    other.close();
+    return *this;
+}
+
+/*
+ * Purpose:
+ *      Maps a file read-only, replacing any current mapping.
+ * Input(s):
+ *      const std::string& path - file to map
+ * Output:
+ *      bool - false if the file is missing, empty or cannot be mapped
+ */
+bool ECE_MappedFile::open(const std::string& path)
+{
+    close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    LARGE_INTEGER size;
+    HANDLE mapping = nullptr;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    {
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    }
+    CloseHandle(file);                                      // the mapping keeps the file open
+    if (!mapping)
+    {
+        return false;
+    }
+    m_data = static_cast<const unsigned char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!m_data)
+    {
+        CloseHandle(mapping);
+        return false;
+    }
+    m_mapping = mapping;
+    m_size    = static_cast<std::size_t>(size.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat st;
+    void* p = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        p = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);                                            // the mapping keeps the file open
+    if (p == MAP_FAILED)
+    {
+        return false;
+    }
+    m_data = static_cast<const unsigned char*>(p);
+    m_size = static_cast<std::size_t>(st.st_size);
+#endif
+    return true;
+}
+
+/*
+ * Purpose:
+ *      Unmaps the file (safe to call when nothing is mapped).
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_MappedFile::close()
+{
+    if (!m_data)
+    {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mapping);
+    m_mapping = nullptr;
+#else
+    munmap(const_cast<unsigned char*>(m_data), m_size);
+#endif
+    m_data = nullptr;
+    m_size = 0;
+}
+
+// ---------------------------- ECE_TextureCache ----------------------------
+
+/*
+ * Purpose:
+ *      Creates the cache directory if needed.
+ * Input(s):
+ *      const std::string& dir - where blobs live ("" disables the cache)
+ * Output:
+ *      None (constructor).
+ */
+ECE_TextureCache::ECE_TextureCache(const std::string& dir)
+: m_dir(dir)
+{
+    if (!m_dir.empty())
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(m_dir, ec);
+        if (ec)
+        { // unwritable location: run uncached rather than fail
+            m_dir.clear();
+        }
+    }
+}
+
+/*
+ * Purpose:
+ *      Blob path for a source file: <dir>/<file name>.rgba
+ * Input(s):
+ *      const std::string& sourcePath - source image path
+ * Output:
+ *      std::string - cache file path
+ */
+std::string ECE_TextureCache::blobPath(const std::string& sourcePath) const
+{
+    return m_dir + "/" + std::filesystem::path(sourcePath).filename().string() + ".rgba";
+}
+
+/*
+ * Purpose:
+ *      Gets an image's pixels, from its blob if that is still current,
+ *      otherwise by decoding the source and rewriting the blob.
+ * Input(s):
+ *      const std::string& sourcePath - the PNG (or any SFML image format)
+ *      Decoded& out                  - receives the pixels
+ * Output:
+ *      bool - false if the source could not be read or decoded
+ */
+bool ECE_TextureCache::load(const std::string& sourcePath, Decoded& out) const
+{
+    std::ifstream in(sourcePath, std::ios::binary);
+    if (!in)
+    { // same report SFML prints for a missing file
+        err() << "Failed to load image \"" << sourcePath << "\". Reason: Unable to open file" << std::endl;
+        return false;
+    }
+    const std::vector<unsigned char> source((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    return load(sourcePath, source.data(), source.size(), out);
+}
+
+/*
+ * Purpose:
+ *      Same as load(path), for a source already in memory.
+ * Input(s):
+ *      const std::string& name   - source name, e.g. its relative path
+ *      const unsigned char* data - encoded image bytes
+ *      std::size_t size          - length of data
+ *      Decoded& out              - receives the pixels
+ * Output:
+ *      bool - false if the bytes could not be decoded
+ */
+bool ECE_TextureCache::load(const std::string& name, const unsigned char* data, std::size_t size, Decoded& out) const
+{
+    const std::uint64_t hash = fnv1a64(data, size);
+
+    if (!m_dir.empty() && out.blob.open(blobPath(name)))
+    { // hit only if the blob is complete and was made from exactly this source
+        BlobHeader h;
+        if (out.blob.size() >= sizeof(h))
+        {
+            std::memcpy(&h, out.blob.data(), sizeof(h));
+            const std::uint64_t pixelBytes = std::uint64_t(h.width) * h.height * 4;
+            if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) == 0 && h.version == kVersion &&
+                h.format == kFormatRgba8 && h.sourceSize == size && h.sourceHash == hash &&
+                out.blob.size() == sizeof(h) + pixelBytes)
+            {
+                out.pixels    = out.blob.data() + sizeof(h);
+                out.size      = {h.width, h.height};
+                out.fromCache = true;
+                return true;
+            }
+        }
+        out.blob.close();                                   // stale or torn: regenerate below
+    }
+
+    if (size == 0 || !out.image.loadFromMemory(data, size))
+    {
+        return false;
+    }
+    out.pixels    = out.image.getPixelsPtr();
+    out.size      = out.image.getSize();
+    out.fromCache = false;
+
+    if (!m_dir.empty())
+    { // write the blob next to its final name, then rename over the old one
+        BlobHeader h = {};
+        std::memcpy(h.magic, kMagic, sizeof(kMagic));
+        h.version    = kVersion;
+        h.width      = out.size.x;
+        h.height     = out.size.y;
+        h.format     = kFormatRgba8;
+        h.sourceSize = size;
+        h.sourceHash = hash;
+
+        const std::string path = blobPath(name);
+        const std::string tmp  = path + ".tmp";
+        bool written;
+        {
+            std::ofstream blob(tmp, std::ios::binary | std::ios::trunc);
+            blob.write(reinterpret_cast<const char*>(&h), sizeof(h));
+            blob.write(reinterpret_cast<const char*>(out.pixels), std::streamsize(out.size.x) * out.size.y * 4);
+            written = static_cast<bool>(blob);
+        }
+        std::error_code ec;
+        if (written)
+        {
+            std::filesystem::rename(tmp, path, ec);
+        }
+        if (!written || ec)
+        { // caching is best effort; the decoded pixels are still good
+            std::filesystem::remove(tmp, ec);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,146 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the ECE_TextureCache class. Keeps an on-disk copy of every
+decoded image as a raw RGBA blob, so later launches map the pixels straight
+into memory and hand them to Texture::update instead of inflating the PNG
+again. Each blob starts with a small header (magic, version, size, pixel
+format, source size and source hash); a blob whose header does not match
+the current source file is ignored and regenerated.
+
+Blobs are a local cache in native byte order, not a distribution format.
+*/
+
+#pragma once
+
+#include <SFML/Graphics.hpp>    // sf::Image, sf::Vector2u, sf::Uint8
+#include <cstddef>              // std::size_t for mapping sizes
+#include <string>               // std::string for paths
+
+// using namespace for readability
+using namespace sf;
+
+/*
+ * Class: ECE_MappedFile
+ * Purpose: Read-only memory mapping of a whole file (RAII, move-only).
+ */
+class ECE_MappedFile
+{
+public:
+    ECE_MappedFile() = default;
+    ~ECE_MappedFile() { close(); }
+
+    ECE_MappedFile(ECE_MappedFile&& other) noexcept;
+    ECE_MappedFile& operator=(ECE_MappedFile&& other) noexcept;
+    ECE_MappedFile(const ECE_MappedFile&) = delete;
+    ECE_MappedFile& operator=(const ECE_MappedFile&) = delete;
+
+    /*
+     * Purpose:
+     *      Maps a file read-only, replacing any current mapping.
+     * Input(s):
+     *      const std::string& path - file to map
+     * Output:
+     *      bool - false if the file is missing, empty or cannot be mapped
+     */
+    bool open(const std::string& path);
+
+    /*
+     * Purpose:
+     *      Unmaps the file (safe to call when nothing is mapped).
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void close();
+
+    const unsigned char* data() const { return m_data; }
+    std::size_t          size() const { return m_size; }
+
+private:
+    const unsigned char* m_data = nullptr;
+    std::size_t          m_size = 0;
+#ifdef _WIN32
+    void*                m_mapping = nullptr;       // HANDLE of the file mapping object
+#endif
+};
+
+/*
+ * Class: ECE_TextureCache
+ * Purpose: Decode-once storage of image pixels keyed by source content.
+ * Notes:
+ *      load() is safe to call from several threads at once for different
+ *      source files.
+ */
+class ECE_TextureCache
+{
+public:
+    /*
+     * Purpose:
+     *      Pixels of one image: either a mapped cache blob or a fresh decode.
+     * Fields:
+     *      pixels    - size.x * size.y RGBA texels (points into blob or image)
+     *      size      - width/height in pixels
+     *      fromCache - true if pixels come from a mapped blob
+     */
+    struct Decoded
+    {
+        const Uint8*   pixels    = nullptr;
+        Vector2u       size;
+        bool           fromCache = false;
+        ECE_MappedFile blob;                        // owns pixels on a cache hit
+        Image          image;                       // owns pixels on a miss
+    };
+
+    /*
+     * Purpose:
+     *      Creates the cache directory if needed.
+     * Input(s):
+     *      const std::string& dir - where blobs live ("" disables the cache)
+     * Output:
+     *      None (constructor).
+     */
+    explicit ECE_TextureCache(const std::string& dir);
+
+    /*
+     * Purpose:
+     *      Gets an image's pixels, from its blob if that is still current,
+     *      otherwise by decoding the source and rewriting the blob.
+     * Input(s):
+     *      const std::string& sourcePath - the PNG (or any SFML image format)
+     *      Decoded& out                  - receives the pixels
+     * Output:
+     *      bool - false if the source could not be read or decoded
+     */
+    bool load(const std::string& sourcePath, Decoded& out) const;
+
+    /*
+     * Purpose:
+     *      Same as load(path), for a source already in memory (an embedded
+     *      asset); the name only picks the blob file.
+     * Input(s):
+     *      const std::string& name   - source name, e.g. its relative path
+     *      const unsigned char* data - encoded image bytes
+     *      std::size_t size          - length of data
+     *      Decoded& out              - receives the pixels
+     * Output:
+     *      bool - false if the bytes could not be decoded
+     */
+    bool load(const std::string& name, const unsigned char* data, std::size_t size, Decoded& out) const;
+
+private:
+    /*
+     * Purpose:
+     *      Blob path for a source file: <dir>/<file name>.rgba
+     * Input(s):
+     *      const std::string& sourcePath - source image path
+     * Output:
+     *      std::string - cache file path
+     */
+    std::string blobPath(const std::string& sourcePath) const;
+
+    std::string m_dir;
+};
@@ -0,0 +1,184 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_TextureLoader class. Workers only touch
+their own request's pixels and then publish them through the request's
+atomic state; the render thread never reads an image before that.
+*/
+
+#include "ECE_TextureLoader.h"  // Class declaration and interface
+#include <utility>              // std::move for requests
+
+/*
+ * Purpose:
+ *      Starts the decode workers.
+ * Input(s):
+ *      const std::string& cacheDir - decoded-blob cache ("" = always decode)
+ *      unsigned int threads        - decode threads (0 = one per hardware thread)
+ * Output:
+ *      None (constructor).
+ */
+ECE_TextureLoader::ECE_TextureLoader(const std::string& cacheDir, unsigned int threads)
+: m_cache(cacheDir),
+  m_pool(threads)
+{
+}
+
+/*
+ * Purpose:
+ *      Queues a file for decoding into target.
+ * Input(s):
+ *      const std::string& path - image file
+ *      Texture& target         - receives the pixels on upload
+ * Output:
+ *      std::size_t - request id for waitFor()/isLoaded()
+ */
+std::size_t ECE_TextureLoader::request(const std::string& path, Texture& target)
+{
+    std::unique_ptr<Request> r(new Request);
+    r->path   = path;
+    r->target = &target;
+    return enqueue(std::move(r));
+}
+
+/*
+ * Purpose:
+ *      Queues an encoded image already in memory (an embedded asset).
+ * Input(s):
+ *      const std::string& name   - source name (picks the cache blob)
+ *      const unsigned char* data - encoded bytes; must outlive the decode
+ *      std::size_t size          - length of data
+ *      Texture& target           - receives the pixels on upload
+ * Output:
+ *      std::size_t - request id for waitFor()/isLoaded()
+ */
+std::size_t ECE_TextureLoader::request(const std::string& name, const unsigned char* data, std::size_t size,
+                                       Texture& target)
+{
+    std::unique_ptr<Request> r(new Request);
+    r->path   = name;
+    r->data   = data;
+    r->size   = size;
+    r->target = &target;
+    return enqueue(std::move(r));
+}
+
+/*
+ * Purpose:
+ *      Stores a request and queues its decode.
+ * Input(s):
+ *      std::unique_ptr<Request> request - filled-in request
+ * Output:
+ *      std::size_t - request id
+ */
+std::size_t ECE_TextureLoader::enqueue(std::unique_ptr<Request> request)
+{
+    Request* r = request.get();
+    m_requests.push_back(std::move(request));
+    ++m_pending;
+
+    m_pool.submit([this, r]
+    {
+        const bool ok = r->data ? m_cache.load(r->path, r->data, r->size, r->pixels)
+                                : m_cache.load(r->path, r->pixels);     // mapped blob, or PNG inflate on a miss
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            r->state.store(ok ? Decoded : Failed);
+        }
+        m_decoded.notify_all();
+    });
+    return m_requests.size() - 1;
+}
+
+/*
+ * Purpose:
+ *      Uploads every image that has finished decoding since the last call.
+ * Input(s):
+ *      None
+ * Output:
+ *      bool - true once every request has been uploaded (or failed)
+ */
+bool ECE_TextureLoader::uploadReady()
+{
+    if (m_pending == 0)
+    {
+        return true;
+    }
+    for (auto& r : m_requests)
+    {
+        const int state = r->state.load();
+        if (state == Decoded || state == Failed)
+        {
+            upload(*r);
+        }
+    }
+    return m_pending == 0;
+}
+
+/*
+ * Purpose:
+ *      Blocks until one request is decoded, then uploads it.
+ * Input(s):
+ *      std::size_t id - value returned by request()
+ * Output:
+ *      bool - false if the file could not be decoded
+ */
+bool ECE_TextureLoader::waitFor(std::size_t id)
+{
+    Request& r = *m_requests[id];
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_decoded.wait(lock, [&r] { return r.state.load() != Decoding; });
+    }
+    upload(r);
+    return r.state.load() == Uploaded;
+}
+
+/*
+ * Purpose:
+ *      Blocks until every request is decoded and uploads them all.
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_TextureLoader::finish()
+{
+    for (std::size_t id = 0; id < m_requests.size(); ++id)
+    {
+        waitFor(id);
+    }
+}
+
+/*
+ * Purpose:
+ *      Copies one decoded image into its texture and frees the pixels.
+ * Input(s):
+ *      Request& r - a request whose decode has finished
+ * Output:
+ *      None
+ * Notes:
+ *      No-op for requests already handled, so callers need not track them.
+ */
+void ECE_TextureLoader::upload(Request& r)
+{
+    const int state = r.state.load();
+    if (state == Decoded)
+    {
+        const Vector2u size = r.pixels.size;
+        if (r.target->create(size.x, size.y))
+        {
+            r.target->update(r.pixels.pixels);              // straight from the mapped blob on a cache hit
+        }
+        r.pixels = ECE_TextureCache::Decoded();             // unmap / drop the CPU copy
+        r.state.store(Uploaded);
+        --m_pending;
+    }
+    else if (state == Failed)
+    {
+        r.state.store(Dropped);
+        --m_pending;
+    }
+}
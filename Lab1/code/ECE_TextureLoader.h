@@ -0,0 +1,150 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the ECE_TextureLoader class. Decodes image files into
+pixels on worker threads in parallel (through ECE_TextureCache, so
+unchanged files skip the decode entirely); the render thread then uploads
+each finished image into its sf::Texture (GPU uploads must stay on the
+thread that owns the GL context). Lets the window show the first screen as
+soon as that one image is ready instead of after every PNG is decoded.
+*/
+
+#pragma once
+
+#include <SFML/Graphics.hpp>    // sf::Image, sf::Texture
+#include <atomic>               // std::atomic for per-request state
+#include <condition_variable>   // std::condition_variable to wait for a decode
+#include <cstddef>              // std::size_t for request ids
+#include <memory>               // std::unique_ptr for stable request storage
+#include <mutex>                // std::mutex paired with the condition variable
+#include <string>               // std::string for file paths
+#include <vector>               // std::vector for requests
+
+#include "ECE_TextureCache.h"   // Decoded-pixel cache the workers read through
+#include "ECE_ThreadPool.h"     // Workers that run the decodes
+
+// using namespace for readability
+using namespace sf;
+
+/*
+ * Class: ECE_TextureLoader
+ * Purpose: Parallel decode, render-thread upload of textures.
+ * Notes:
+ *      Every method except the decode tasks runs on the render thread.
+ *      Target textures must outlive the loader. A file that fails to decode
+ *      leaves its texture empty (SFML prints the reason), as loadFromFile did.
+ */
+class ECE_TextureLoader
+{
+public:
+    /*
+     * Purpose:
+     *      Starts the decode workers.
+     * Input(s):
+     *      const std::string& cacheDir - decoded-blob cache ("" = always decode)
+     *      unsigned int threads        - decode threads (0 = one per hardware thread)
+     * Output:
+     *      None (constructor).
+     */
+    explicit ECE_TextureLoader(const std::string& cacheDir = "", unsigned int threads = 0);
+
+    /*
+     * Purpose:
+     *      Queues a file for decoding into target.
+     * Input(s):
+     *      const std::string& path - image file
+     *      Texture& target         - receives the pixels on upload
+     * Output:
+     *      std::size_t - request id for waitFor()/isLoaded()
+     */
+    std::size_t request(const std::string& path, Texture& target);
+
+    /*
+     * Purpose:
+     *      Queues an encoded image already in memory (an embedded asset).
+     * Input(s):
+     *      const std::string& name   - source name (picks the cache blob)
+     *      const unsigned char* data - encoded bytes; must outlive the decode
+     *      std::size_t size          - length of data
+     *      Texture& target           - receives the pixels on upload
+     * Output:
+     *      std::size_t - request id for waitFor()/isLoaded()
+     */
+    std::size_t request(const std::string& name, const unsigned char* data, std::size_t size, Texture& target);
+
+    /*
+     * Purpose:
+     *      Uploads every image that has finished decoding since the last call.
+     * Input(s):
+     *      None
+     * Output:
+     *      bool - true once every request has been uploaded (or failed)
+     * Notes:
+     *      Cheap when nothing is pending; call once per frame while loading.
+     */
+    bool uploadReady();
+
+    /*
+     * Purpose:
+     *      Blocks until one request is decoded, then uploads it.
+     * Input(s):
+     *      std::size_t id - value returned by request()
+     * Output:
+     *      bool - false if the file could not be decoded
+     */
+    bool waitFor(std::size_t id);
+
+    /*
+     * Purpose:
+     *      Blocks until every request is decoded and uploads them all.
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     */
+    void finish();
+
+    bool isLoaded(std::size_t id) const { return m_requests[id]->state.load() == Uploaded; }
+
+private:
+    enum State { Decoding, Decoded, Failed, Uploaded, Dropped };   // Dropped = failure already counted
+
+    struct Request
+    {
+        std::string          path;
+        const unsigned char* data = nullptr;        // in-memory source, or nullptr to read path
+        std::size_t          size = 0;
+        Texture*             target = nullptr;
+        ECE_TextureCache::Decoded pixels;         // written by the worker, read after state != Decoding
+        std::atomic<int>     state{Decoding};
+    };
+
+    /*
+     * Purpose:
+     *      Stores a request and queues its decode.
+     * Input(s):
+     *      std::unique_ptr<Request> request - filled-in request
+     * Output:
+     *      std::size_t - request id
+     */
+    std::size_t enqueue(std::unique_ptr<Request> request);
+
+    /*
+     * Purpose:
+     *      Copies one decoded image into its texture and frees the pixels.
+     * Input(s):
+     *      Request& r - a request whose decode has finished
+     * Output:
+     *      None
+     */
+    void upload(Request& r);
+
+    std::vector<std::unique_ptr<Request>> m_requests;
+    std::size_t                           m_pending = 0;    // requests not yet uploaded/failed (render thread only)
+    std::mutex                            m_mutex;
+    std::condition_variable               m_decoded;        // a worker finished a request
+    ECE_TextureCache                      m_cache;
+    ECE_ThreadPool                        m_pool;           // last member: joins before the requests go away
+};
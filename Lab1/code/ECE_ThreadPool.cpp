@@ -0,0 +1,182 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_ThreadPool class. Each deque has its own
+mutex, so owners and thieves only contend when they touch the same deque;
+the shared idle mutex is only taken to park or wake workers.
+*/
+
+#include "ECE_ThreadPool.h"     // Class declaration and interface
+#include <utility>              // std::move for tasks
+
+// Set on worker threads: which pool they belong to and the index of their own deque
+static thread_local const ECE_ThreadPool* t_pool = nullptr;
+static thread_local std::size_t           t_self = 0;
+
+/*
+ * Purpose:
+ *      Starts the worker threads.
+ * Input(s):
+ *      unsigned int threads - worker count (0 = one per hardware thread)
+ * Output:
+ *      None (constructor).
+ */
+ECE_ThreadPool::ECE_ThreadPool(unsigned int threads)
+{
+    if (threads == 0)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads == 0)
+    { // hardware_concurrency may be unknown
+        threads = 1;
+    }
+
+    for (unsigned int i = 0; i < threads; ++i)
+    {
+        m_queues.push_back(std::unique_ptr<Queue>(new Queue));
+    }
+    for (unsigned int i = 0; i < threads; ++i)
+    {
+        m_workers.emplace_back(&ECE_ThreadPool::workerLoop, this, i);
+    }
+}
+
+/*
+ * Purpose:
+ *      Finishes every queued task, then joins the workers.
+ * Input(s):
+ *      None
+ * Output:
+ *      None (destructor).
+ */
+ECE_ThreadPool::~ECE_ThreadPool()
+{
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(m_idleMutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+/*
+ * Purpose:
+ *      Queues a task.
+ * Input(s):
+ *      std::function<void()> task - work to run on some worker
+ * Output:
+ *      None
+ */
+void ECE_ThreadPool::submit(std::function<void()> task)
+{
+    const std::size_t target = (t_pool == this) ? t_self
+                                                : m_nextQueue.fetch_add(1) % m_queues.size();
+    m_outstanding.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(m_idleMutex);  // pairs with the check in workerLoop so no wakeup is lost
+        m_queued.fetch_add(1);                          // counted before the push so it never goes negative
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_queues[target]->mutex);
+        m_queues[target]->tasks.push_back(std::move(task));
+    }
+    m_wake.notify_one();
+}
+
+/*
+ * Purpose:
+ *      Blocks until every submitted task has finished.
+ * Input(s):
+ *      None
+ * Output:
+ *      None
+ */
+void ECE_ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock(m_idleMutex);
+    m_done.wait(lock, [this] { return m_outstanding.load() == 0; });
+}
+
+/*
+ * Purpose:
+ *      Takes one task: newest from the own deque, else oldest from another.
+ * Input(s):
+ *      std::size_t self             - index of the calling worker
+ *      std::function<void()>& task  - receives the task
+ * Output:
+ *      bool - false if every deque was empty
+ */
+bool ECE_ThreadPool::takeTask(std::size_t self, std::function<void()>& task)
+{
+    {
+        Queue& own = *m_queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty())
+        { // LIFO on the own deque: most recently queued work is cache-warm
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            m_queued.fetch_sub(1);
+            return true;
+        }
+    }
+
+    const std::size_t n = m_queues.size();
+    for (std::size_t k = 1; k < n; ++k)
+    { // steal FIFO from the others, starting with the next worker over
+        Queue& victim = *m_queues[(self + k) % n];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            m_queued.fetch_sub(1);
+            m_steals.fetch_add(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Purpose:
+ *      Worker loop: run own tasks, steal when empty, park when idle.
+ * Input(s):
+ *      std::size_t self - index of this worker's queue
+ * Output:
+ *      None
+ */
+void ECE_ThreadPool::workerLoop(std::size_t self)
+{
+    t_pool = this;
+    t_self = self;
+
+    std::function<void()> task;
+    for (;;)
+    {
+        if (takeTask(self, task))
+        {
+            task();
+            task = nullptr;                                     // release captures before signalling
+            if (m_outstanding.fetch_sub(1) == 1)
+            { // last outstanding task: wake anyone in wait()
+                std::lock_guard<std::mutex> lock(m_idleMutex);
+                m_done.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_idleMutex);
+        m_wake.wait(lock, [this] { return m_stop || m_queued.load() > 0; });
+        if (m_stop && m_queued.load() == 0)
+        {
+            return;
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the ECE_ThreadPool class. A fixed set of worker threads,
+each with its own task deque. A worker takes its newest task first (warm
+caches), and when its deque runs dry it steals the oldest task from another
+worker, so uneven task lengths (short lost rounds vs. long won ones) still
+keep every core busy.
+*/
+
+#pragma once
+
+#include <atomic>               // std::atomic for the outstanding-task count
+#include <condition_variable>   // std::condition_variable to park idle workers
+#include <cstddef>              // std::size_t for counts
+#include <deque>                // std::deque for the per-worker task queues
+#include <functional>           // std::function for type-erased tasks
+#include <memory>               // std::unique_ptr for the (non-movable) worker queues
+#include <mutex>                // std::mutex for queue access
+#include <thread>               // std::thread for the workers
+#include <vector>               // std::vector for workers and queues
+
+/*
+ * Class: ECE_ThreadPool
+ * Purpose: Work-stealing pool for independent tasks.
+ * Notes:
+ *      Tasks must not throw. submit() may be called from any thread,
+ *      including from inside a task.
+ */
+class ECE_ThreadPool
+{
+public:
+    /*
+     * Purpose:
+     *      Starts the worker threads.
+     * Input(s):
+     *      unsigned int threads - worker count (0 = one per hardware thread)
+     * Output:
+     *      None (constructor).
+     */
+    explicit ECE_ThreadPool(unsigned int threads = 0);
+
+    /*
+     * Purpose:
+     *      Finishes every queued task, then joins the workers.
+     * Input(s):
+     *      None
+     * Output:
+     *      None (destructor).
+     */
+    ~ECE_ThreadPool();
+
+    ECE_ThreadPool(const ECE_ThreadPool&) = delete;
+    ECE_ThreadPool& operator=(const ECE_ThreadPool&) = delete;
+
+    /*
+     * Purpose:
+     *      Queues a task.
+     * Input(s):
+     *      std::function<void()> task - work to run on some worker
+     * Output:
+     *      None
+     * Notes:
+     *      Called from a worker, the task goes on that worker's own deque;
+     *      otherwise deques are filled round-robin.
+     */
+    void submit(std::function<void()> task);
+
+    /*
+     * Purpose:
+     *      Blocks until every submitted task has finished.
+     * Input(s):
+     *      None
+     * Output:
+     *      None
+     * Notes:
+     *      Call from outside the pool; a task that waits would wait on itself.
+     */
+    void wait();
+
+    std::size_t threadCount() const { return m_workers.size(); }
+    std::size_t stealCount()  const { return m_steals.load(); }   // tasks run by a worker other than the one queued on
+
+private:
+    struct Queue
+    {
+        std::mutex                        mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    /*
+     * Purpose:
+     *      Worker loop: run own tasks, steal when empty, park when idle.
+     * Input(s):
+     *      std::size_t self - index of this worker's queue
+     * Output:
+     *      None
+     */
+    void workerLoop(std::size_t self);
+
+    /*
+     * Purpose:
+     *      Takes one task: newest from the own deque, else oldest from another.
+     * Input(s):
+     *      std::size_t self             - index of the calling worker
+     *      std::function<void()>& task  - receives the task
+     * Output:
+     *      bool - false if every deque was empty
+     */
+    bool takeTask(std::size_t self, std::function<void()>& task);
+
+    std::vector<std::unique_ptr<Queue>> m_queues;     // one per worker
+    std::vector<std::thread>            m_workers;
+
+    std::mutex              m_idleMutex;              // guards the sleep/wake handshake
+    std::condition_variable m_wake;                   // new work or shutdown
+    std::condition_variable m_done;                   // outstanding count reached zero
+    std::atomic<std::size_t> m_queued{0};             // tasks sitting in deques
+    std::atomic<std::size_t> m_outstanding{0};        // submitted but not finished
+    std::atomic<std::size_t> m_nextQueue{0};          // round-robin cursor for external submits
+    std::atomic<std::size_t> m_steals{0};
+    bool                     m_stop = false;          // guarded by m_idleMutex
+};
@@ -0,0 +1,113 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation file for the ECE_UniformGrid class. build() is a counting
+sort: count entries per cell, prefix-sum into start offsets, then scatter
+enemy indices into their cells.
+*/
+
+#include "ECE_UniformGrid.h"    // Class declaration and interface
+#include "ECE_Profiler.h"       // BUZZY_PROFILE_ZONE phase timer
+#include <algorithm>            // std::clamp / std::max for cell coordinates
+#include <cmath>                // std::floor / std::ceil for grid dimensions
+
+/*
+ * Purpose:
+ *      Sets the cell size and the area the grid covers.
+ * Input(s):
+ *      float cellSize     - edge length of a cell in pixels
+ *      Vector2u worldSize - playfield dimensions in pixels
+ * Output:
+ *      None
+ */
+void ECE_UniformGrid::configure(float cellSize, Vector2u worldSize)
+{
+    m_cellSize = std::max(cellSize, 1.f);
+    m_invCell  = 1.f / m_cellSize;
+    m_cols     = std::max(1, static_cast<int>(std::ceil(worldSize.x * m_invCell)));
+    m_rows     = std::max(1, static_cast<int>(std::ceil(worldSize.y * m_invCell)));
+
+    const std::size_t cells = static_cast<std::size_t>(m_cols) * m_rows;
+    m_cellStart.assign(cells + 1, 0);
+    m_cursor.assign(cells, 0);
+}
+
+/*
+ * Purpose:
+ *      Clamped cell-coordinate range covered by a box.
+ * Input(s):
+ *      const FloatRect& box - area in pixels
+ *      int& c0, r0, c1, r1  - receive the inclusive column/row range
+ * Output:
+ *      None
+ */
+void ECE_UniformGrid::cellRange(const FloatRect& box, int& c0, int& r0, int& c1, int& r1) const
+{
+    c0 = std::clamp(static_cast<int>(std::floor(box.left * m_invCell)),                 0, m_cols - 1);
+    r0 = std::clamp(static_cast<int>(std::floor(box.top  * m_invCell)),                 0, m_rows - 1);
+    c1 = std::clamp(static_cast<int>(std::floor((box.left + box.width)  * m_invCell)),  0, m_cols - 1);
+    r1 = std::clamp(static_cast<int>(std::floor((box.top  + box.height) * m_invCell)),  0, m_rows - 1);
+}
+
+/*
+ * Purpose:
+ *      Rebuilds the grid from the live enemies' swept bounds (where each
+ *      enemy was at any time during the last tick).
+ * Input(s):
+ *      const ECE_EnemySwarm& enemies - swarm to bin
+ * Output:
+ *      None
+ */
+void ECE_UniformGrid::build(const ECE_EnemySwarm& enemies)
+{
+    BUZZY_PROFILE_ZONE("gridBuild");
+    const std::size_t cells = m_cursor.size();
+    std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+
+    // Pass 1: count how many entries land in each cell (stored shifted by one for the prefix sum)
+    std::size_t total = 0;
+    const std::size_t alive = enemies.aliveCount();
+    for (std::size_t k = 0; k < alive; ++k)
+    { // only live enemies are collision candidates
+        const std::size_t i = enemies.aliveAt(k);
+        int c0, r0, c1, r1;
+        cellRange(enemies.getSweptBounds(i), c0, r0, c1, r1);
+        for (int r = r0; r <= r1; ++r)
+        {
+            for (int c = c0; c <= c1; ++c)
+            {
+                ++m_cellStart[static_cast<std::size_t>(r) * m_cols + c + 1];
+                ++total;
+            }
+        }
+    }
+
+    // Prefix sum: start[i] = number of entries in cells before i
+    for (std::size_t cell = 0; cell < cells; ++cell)
+    {
+        m_cellStart[cell + 1] += m_cellStart[cell];
+        m_cursor[cell] = m_cellStart[cell];
+    }
+
+    if (m_items.size() < total)
+    { // grows only while the swarm is larger than any seen before
+        m_items.resize(total);
+    }
+
+    // Pass 2: scatter enemy indices into their cells
+    for (std::size_t k = 0; k < alive; ++k)
+    {
+        const std::size_t i = enemies.aliveAt(k);
+        int c0, r0, c1, r1;
+        cellRange(enemies.getSweptBounds(i), c0, r0, c1, r1);
+        for (int r = r0; r <= r1; ++r)
+        {
+            for (int c = c0; c <= c1; ++c)
+            {
+                m_items[m_cursor[static_cast<std::size_t>(r) * m_cols + c]++] = static_cast<std::uint32_t>(i);
+            }
+        }
+    }
+}
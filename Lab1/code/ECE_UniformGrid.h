@@ -0,0 +1,116 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the ECE_UniformGrid class. A uniform spatial grid over the
+playfield used as a collision broadphase for the enemy swarm. The grid is
+rebuilt every tick with a counting sort into flat arrays (cell start offsets
+plus packed enemy indices), so a rebuild is two linear passes and, once the
+arrays have grown to size, allocates nothing.
+*/
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>   // sf::FloatRect for query boxes
+#include <SFML/System/Vector2.hpp>  // sf::Vector2u for the playfield size
+#include <cstddef>                  // std::size_t for indices
+#include <cstdint>                  // std::uint32_t for packed indices
+#include <vector>                   // std::vector for the cell arrays
+
+#include "ECE_EnemySwarm.h"         // Structure-of-arrays enemy formation
+
+// using namespace for readability
+using namespace sf;
+
+/*
+ * Class: ECE_UniformGrid
+ * Purpose: Bins live enemies into square cells so a query box only visits
+ *          enemies in the cells it overlaps.
+ * Notes:
+ *      Positions outside the playfield are clamped into the border cells, so
+ *      enemies that drift off-screen are still found.
+ */
+class ECE_UniformGrid
+{
+public:
+    /*
+     * Purpose:
+     *      Sets the cell size and the area the grid covers.
+     * Input(s):
+     *      float cellSize     - edge length of a cell in pixels (use the
+     *                           enemy size so each enemy spans at most 2x2 cells)
+     *      Vector2u worldSize - playfield dimensions in pixels
+     * Output:
+     *      None
+     */
+    void configure(float cellSize, Vector2u worldSize);
+
+    /*
+     * Purpose:
+     *      Rebuilds the grid from the live enemies' swept bounds (where each
+     *      enemy was at any time during the last tick).
+     * Input(s):
+     *      const ECE_EnemySwarm& enemies - swarm to bin
+     * Output:
+     *      None
+     * Notes:
+     *      Query with a swept box too: two things that touch at some moment
+     *      of the tick have overlapping swept boxes, so they share a cell.
+     */
+    void build(const ECE_EnemySwarm& enemies);
+
+    /*
+     * Purpose:
+     *      Calls visit(enemyIndex) for every enemy binned in a cell that the
+     *      box overlaps.
+     * Input(s):
+     *      const FloatRect& box - query area in pixels
+     *      Visit&& visit        - callable taking std::size_t
+     * Output:
+     *      None
+     * Notes:
+     *      An enemy spanning several overlapped cells is visited once per
+     *      cell; callers must tolerate repeats. Enemies killed since the last
+     *      build are still visited.
+     */
+    template <typename Visit>
+    void query(const FloatRect& box, Visit&& visit) const
+    {
+        int c0, r0, c1, r1;
+        cellRange(box, c0, r0, c1, r1);
+        for (int r = r0; r <= r1; ++r)
+        {
+            for (int c = c0; c <= c1; ++c)
+            {
+                const std::size_t cell = static_cast<std::size_t>(r) * m_cols + c;
+                for (std::uint32_t k = m_cellStart[cell]; k < m_cellStart[cell + 1]; ++k)
+                {
+                    visit(static_cast<std::size_t>(m_items[k]));
+                }
+            }
+        }
+    }
+
+    float getCellSize() const { return m_cellSize; }
+
+private:
+    /*
+     * Purpose:
+     *      Clamped cell-coordinate range covered by a box.
+     * Input(s):
+     *      const FloatRect& box - area in pixels
+     *      int& c0, r0, c1, r1  - receive the inclusive column/row range
+     * Output:
+     *      None
+     */
+    void cellRange(const FloatRect& box, int& c0, int& r0, int& c1, int& r1) const;
+
+    float m_cellSize = 1.f;
+    float m_invCell  = 1.f;                     // 1 / m_cellSize
+    int   m_cols = 1, m_rows = 1;
+
+    std::vector<std::uint32_t> m_cellStart;     // size cells+1: items of cell i are [start[i], start[i+1])
+    std::vector<std::uint32_t> m_items;         // enemy indices grouped by cell
+    std::vector<std::uint32_t> m_cursor;        // per-cell write cursor used during build
+};
@@ -0,0 +1,98 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation of the headless simulation core. GameState::step() drives
+the per-frame gameplay systems declared in GameSystems.h (spawning,
+movement, collisions, win check) that used to live in the main game loop.
+*/
+
+#include "GameState.h"
+
+#include "ECE_Profiler.h"      // BUZZY_PROFILE_ZONE phase timers
+#include "GameSystems.h"       // Per-tick gameplay systems
+
+// ------------------------------ GameState ------------------------------
+
+/*
+ * Purpose:
+ *      Builds a fresh round: player at the top, swarm in the lower half.
+ * Input(s):
+ *      const GameConfig& config - tuning constants and layout
+ * Output:
+ *      None (constructor).
+ */
+GameState::GameState(const GameConfig& config)
+: m_config(config),
+  m_buzzy(makeBuzzy(m_config)),
+  m_playerShots(static_cast<std::size_t>(config.maxPlayerShots),
+                laserHalfExtents(config.laserTexSize)),
+  m_enemyShots(static_cast<std::size_t>(config.maxEnemyShots),
+               m_playerShots.getHalfExtents()),
+  m_enemySpeedX(config.enemySpeedX),
+  m_rng(config.seed)
+{
+    createEnemies(m_enemies, m_config);
+    m_enemyGrid.configure(broadphaseCellSize(m_enemies), m_config.windowSize);
+    if (m_config.collisionThreads != 1)
+    {
+        m_collisionPool = std::make_unique<ECE_ThreadPool>(m_config.collisionThreads);
+    }
+}
+
+/*
+ * Purpose:
+ *      Advances the round by dt seconds using the given input.
+ * Input(s):
+ *      float dt                - elapsed simulation time (seconds)
+ *      const InputFrame& input - player input for this step
+ * Output:
+ *      StepResult - Running, or Win/Lose once the round is decided.
+ */
+StepResult GameState::step(float dt, const InputFrame& input)
+{
+    BUZZY_PROFILE_ZONE("GameState::step");
+    const float windowWidth  = static_cast<float>(m_config.windowSize.x);
+    const float windowHeight = static_cast<float>(m_config.windowSize.y);
+
+    savePreviousPositions(m_buzzy, m_enemies, m_playerShots, m_enemyShots);
+
+    if (input.fire)
+    { // fire pressed this step
+        spawnPlayerLaser(m_buzzy, m_playerShots, m_config.playerShotSpeed);
+    }
+
+    m_enemyShotTimer += dt;
+    if (m_enemyShotTimer >= m_config.enemyShotsInterval)
+    { // enemy cadence elapsed; restart the interval like the old Clock did
+        spawnEnemyLaser(m_enemyShots, m_enemies, m_config.enemyShotSpeed, m_rng);
+        m_enemyShotTimer = 0.f;
+    }
+
+    {
+        BUZZY_PROFILE_ZONE("buzzyUpdate");
+        m_buzzy.update(dt, windowWidth, input.left, input.right);
+    }
+    updateShots(m_playerShots, m_enemyShots, dt);
+    updateEnemies(m_enemies, dt, windowWidth, m_enemySpeedX, m_dir, m_config.stepUp);
+
+    m_enemyGrid.build(m_enemies);
+    checkPlayerShotCollisions(m_playerShots, m_enemies, m_enemyGrid, m_shotResolver, m_collisionPool.get());
+
+    m_enemyShotAxis.sync(m_enemyShots);
+    const bool killedByShot  = checkEnemyShotCollisions(m_enemyShots, m_buzzy, m_enemyShotAxis);
+    const bool collidedEnemy = checkPlayerEnemyCollision(m_buzzy, m_enemies, m_enemyGrid);
+    cullShots(m_playerShots, m_enemyShots, windowHeight);
+    if (killedByShot || collidedEnemy)
+    {
+        return StepResult::Lose;
+    }
+
+    if (checkWin(m_enemies))
+    {
+        return StepResult::Win;
+    }
+
+    return StepResult::Running;
+}
@@ -0,0 +1,157 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Headless simulation core for Buzzy Defender. GameState owns one round's
+entities (player, enemy swarm, lasers) and advances them with step(dt, input).
+Nothing in here touches a RenderWindow or polls the keyboard, so the same
+logic drives both the SFML front end and display-less tools (CI, balancing).
+*/
+
+#pragma once
+
+#include <SFML/System/Vector2.hpp>  // sf::Vector2u for sizes (no SFML graphics objects in the core)
+#include <cstdint>              // std::uint32_t for the RNG seed
+#include <memory>               // std::unique_ptr for the optional collision pool
+#include <random>               // std::mt19937 for enemy fire (same sequence on every platform)
+
+#include "ECE_Buzzy.h"          // Player entity (transform + hitbox components)
+#include "ECE_LaserPool.h"      // Fixed-capacity laser projectile pool
+#include "ECE_EnemySwarm.h"     // Structure-of-arrays enemy formation
+#include "ECE_UniformGrid.h"    // Broadphase grid over the swarm
+#include "ECE_SweepAxis.h"      // Sorted-axis broadphase over the enemy shots
+#include "ECE_ShotResolver.h"   // Parallel player-shot collision search
+#include "ECE_ThreadPool.h"     // Workers for the collision search
+
+// using namespace for readability
+using namespace sf;
+
+/*
+ * Purpose:
+ *      One tick worth of player input, decoupled from where it came from
+ *      (live keyboard, a replay, or a scripted bot).
+ * Fields:
+ *      left  - move-left held this tick
+ *      right - move-right held this tick
+ *      fire  - fire pressed this tick (edge, not held)
+ */
+struct InputFrame
+{
+    bool left  = false;
+    bool right = false;
+    bool fire  = false;
+};
+
+/*
+ * Purpose:
+ *      Result of advancing the simulation by one step.
+ * Values:
+ *      Running - round still in progress
+ *      Win     - all enemies destroyed
+ *      Lose    - player hit by a laser or touched by an enemy
+ */
+enum class StepResult
+{
+    Running, Win, Lose
+};
+
+/*
+ * Purpose:
+ *      Tuning constants and playfield layout for one round.
+ * Notes:
+ *      Texture sizes default to the shipped PNGs so a headless round has the
+ *      same hitboxes as the windowed game without loading any image. The
+ *      front end overwrites them from the atlas table's source sizes.
+ */
+struct GameConfig
+{
+    Vector2u windowSize{1920, 1080};    // playfield dimensions in pixels
+
+    float buzzySpeed         = 450.f;   // player horizontal speed (pixels per second)
+    float playerShotSpeed    = 400.f;   // player laser speed (+y = down)
+    float enemyShotSpeed     = -300.f;  // enemy laser speed (-y = up)
+    float enemySpeedX        = 300.f;   // swarm horizontal speed (pixels per second)
+    float stepUp             = -20.f;   // swarm vertical step after hitting a wall
+    float enemyShotsInterval = 0.5f;    // seconds between enemy shots
+
+    std::uint32_t seed = 1;             // seeds the round's RNG; same seed + inputs = same round
+
+    float tickRate        = 120.f;      // fixed simulation ticks per second
+    int   maxCatchUpSteps = 8;          // most ticks run per rendered frame before dropping backlog
+    float maxFrameTime    = 0.25f;      // longest frame (seconds) fed into the accumulator
+
+    int enemyCols = 8;                  // swarm grid columns
+    int enemyRows = 4;                  // swarm grid rows
+
+    int maxPlayerShots = 256;           // hard cap on live player lasers (extra shots are dropped)
+    int maxEnemyShots  = 256;           // hard cap on live enemy lasers
+
+    unsigned int collisionThreads = 1;  // workers for the player-shot collision search (1 = none, 0 = one per core);
+                                        // never changes the outcome, so replays do not record it
+
+    Vector2u buzzyTexSize {362, 379};   // Buzzy_blue.png
+    Vector2u laserTexSize {160, 148};   // laser.png
+    Vector2u enemy1TexSize{288, 302};   // bulldog.png
+    Vector2u enemy2TexSize{872, 917};   // clemson_tigers.png
+};
+
+/*
+ * Class: GameState
+ * Purpose: Owns and advances the state of a single round.
+ * Notes:
+ *      Every entity remembers its position from the start of the last step
+ *      (ECE_Buzzy::getPreviousPosition(),
+ *      ECE_EnemySwarm::getPreviousPosition(i) and
+ *      ECE_LaserPool::getPreviousPosition(i)), so a renderer running between
+ *      fixed ticks can interpolate instead of drawing the raw tick positions.
+ */
+class GameState
+{
+public:
+    /*
+     * Purpose:
+     *      Builds a fresh round: player at the top, swarm in the lower half.
+     * Input(s):
+     *      const GameConfig& config - tuning constants and layout
+     * Output:
+     *      None (constructor).
+     * Notes:
+     *      Entities only carry sizes, never textures; the front end draws
+     *      them from the sprite atlas.
+     */
+    explicit GameState(const GameConfig& config);
+
+    /*
+     * Purpose:
+     *      Advances the round by dt seconds using the given input.
+     * Input(s):
+     *      float dt                - elapsed simulation time (seconds)
+     *      const InputFrame& input - player input for this step
+     * Output:
+     *      StepResult - Running, or Win/Lose once the round is decided.
+     */
+    StepResult step(float dt, const InputFrame& input);
+
+    const GameConfig&                config()      const { return m_config; }
+    const ECE_Buzzy&                 buzzy()       const { return m_buzzy; }
+    const ECE_EnemySwarm&            enemies()     const { return m_enemies; }
+    const ECE_LaserPool&             playerShots() const { return m_playerShots; }
+    const ECE_LaserPool&             enemyShots()  const { return m_enemyShots; }
+
+private:
+    GameConfig   m_config;
+
+    ECE_Buzzy                 m_buzzy;
+    ECE_EnemySwarm            m_enemies;
+    ECE_LaserPool             m_playerShots, m_enemyShots;
+    ECE_UniformGrid           m_enemyGrid;          // rebuilt every step before collisions
+    ECE_SweepAxis             m_enemyShotAxis;      // re-sorted every step before collisions
+    ECE_ShotResolver          m_shotResolver;       // claim scratch reused every step
+    std::unique_ptr<ECE_ThreadPool> m_collisionPool;  // only when config.collisionThreads != 1
+
+    float m_enemySpeedX;            // swarm speed; by value so tuning never leaks between rounds
+    int   m_dir = +1;               // swarm direction (+1 right, -1 left)
+    float m_enemyShotTimer = 0.f;   // seconds since the last enemy shot
+    std::mt19937 m_rng;             // per-round RNG (enemy shooter choice), seeded from config
+};
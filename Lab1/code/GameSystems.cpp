@@ -0,0 +1,473 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Implementation of the per-tick gameplay systems (spawning, movement,
+collisions, win check) that GameState::step() is built from. Kept out of
+GameState.cpp so benchmarks can drive each system on its own.
+*/
+
+#include "GameSystems.h"
+
+#include <algorithm>           // std::min / std::max for enemy spacing and the broadphase cell size
+
+#include "ECE_Profiler.h"      // BUZZY_PROFILE_ZONE phase timers
+
+// --------------------------- Entity Factories ---------------------------
+
+/*
+ * Purpose:
+ *      Half-extents of a laser drawn from a texture of the given size: every
+ *      laser is squeezed into a thin 6x18 pixel bolt whatever the texture.
+ * Input(s):
+ *      Vector2u texSize - laser texture size in pixels
+ * Output:
+ *      Vector2f - half width/height in pixels
+ */
+Vector2f laserHalfExtents(Vector2u texSize)
+{
+    const float sx = 6.f / texSize.x;                      // per-axis scale to the bolt size
+    const float sy = 18.f / texSize.y;
+    return {texSize.x * sx / 2.f, texSize.y * sy / 2.f};
+}
+
+/*
+ * Purpose:
+ *      Builds the player: hitbox fitted to 10% of the window, placed at the
+ *      top center.
+ * Input(s):
+ *      const GameConfig& config - layout and player texture size
+ * Output:
+ *      ECE_Buzzy - scaled and positioned player.
+ */
+ECE_Buzzy makeBuzzy(const GameConfig& config)
+{
+    ECE_Buzzy buzzy(fitHalfExtents(config.buzzyTexSize,
+                                   {config.windowSize.x * 0.10f, config.windowSize.y * 0.10f}));
+    buzzy.setPosition({config.windowSize.x / 2.f, config.windowSize.y * 0.25f});
+    buzzy.setSpeed(config.buzzySpeed);
+    buzzy.savePreviousPosition();
+    return buzzy;
+}
+
+// --------------------------- Gameplay Helpers ---------------------------
+
+/*
+ * Purpose:
+ *      Half-extents of an enemy drawn with a texture of the given size once
+ *      it is scaled uniformly to fit 10% of the window.
+ * Input(s):
+ *      Vector2u texSize    - enemy texture size in pixels
+ *      Vector2u windowSize - window dimensions (for scaling)
+ * Output:
+ *      Vector2f - half width/height in pixels
+ */
+Vector2f enemyHalfExtents(Vector2u texSize, Vector2u windowSize)
+{
+    return fitHalfExtents(texSize, {windowSize.x * 0.1f, windowSize.y * 0.1f});
+}
+
+/*
+ * Purpose:
+ *      Distance between neighbouring enemy centers for the config's grid:
+ *      the usual 120 px, narrowed when the grid would otherwise run past
+ *      the right edge (columns) or the bottom edge (rows) of the window.
+ * Input(s):
+ *      const GameConfig& config - grid size and window size
+ * Output:
+ *      Vector2f - x/y spacing in pixels
+ */
+static Vector2f enemySpacing(const GameConfig& config)
+{
+    const float width  = static_cast<float>(config.windowSize.x);
+    const float height = static_cast<float>(config.windowSize.y);
+    Vector2f spacing{120.f, 120.f};
+    if (config.enemyCols > 1)
+    { // centers span [120, width - 120]
+        spacing.x = std::min(spacing.x, (width - 240.f) / (config.enemyCols - 1));
+    }
+    if (config.enemyRows > 1)
+    { // centers span [0.65 * height, height]
+        spacing.y = std::min(spacing.y, height * 0.35f / (config.enemyRows - 1));
+    }
+    return spacing;
+}
+
+/*
+ * Purpose:
+ *      Checks that createEnemies can lay out the config's grid inside the
+ *      window without enemies overlapping.
+ * Input(s):
+ *      const GameConfig& config - grid size, window size and texture sizes
+ * Output:
+ *      bool - false if the grid is empty or too large for the window
+ */
+bool enemyGridFits(const GameConfig& config)
+{
+    if (config.enemyCols < 1 || config.enemyRows < 1)
+    {
+        return false;
+    }
+    const Vector2f half1   = enemyHalfExtents(config.enemy1TexSize, config.windowSize);
+    const Vector2f half2   = enemyHalfExtents(config.enemy2TexSize, config.windowSize);
+    const Vector2f spacing = enemySpacing(config);
+    return (config.enemyCols == 1 || spacing.x >= 2.f * std::max(half1.x, half2.x)) &&
+           (config.enemyRows == 1 || spacing.y >= 2.f * std::max(half1.y, half2.y));
+}
+
+/*
+ * Purpose:
+ *      Populate the enemy swarm in a grid, scaled relative to the window.
+ * Input(s):
+ *      ECE_EnemySwarm& enemies      - output swarm (cleared & filled)
+ *      const GameConfig& config     - grid size, window size and texture sizes
+ * Output:
+ *      None (enemies swarm is modified).
+ * Notes:
+ *      Grids too wide or tall for the 120 px spacing are packed closer so
+ *      every enemy starts inside the window (see enemyGridFits).
+ */
+void createEnemies(ECE_EnemySwarm& enemies,
+                   const GameConfig& config)
+{
+    const Vector2u windowSize = config.windowSize;
+    const int   cols       = config.enemyCols;     // # cols
+    const int   rows       = config.enemyRows;     // # rows
+    const float startY     = windowSize.y * 0.65f; // lower half
+    const Vector2f spacing = enemySpacing(config);
+    const float xPadding   = spacing.x;            // x spacing between enemies
+    const float yPadding   = spacing.y;            // y spacing between enemies
+    const float leftMargin = 120.f;                // horizontal starting offset
+    const float topMargin  = startY;               // vertical starting offest
+
+    const Vector2f half1 = enemyHalfExtents(config.enemy1TexSize, windowSize);
+    const Vector2f half2 = enemyHalfExtents(config.enemy2TexSize, windowSize);
+
+    enemies.clear();
+    enemies.reserve(cols * rows);   // reserves memory for all enemies
+
+    for (int r = 0; r < rows; ++r)
+    { // create enemies row by row
+        for (int c = 0; c < cols; ++c)
+        { // create enemies in adjacent columns
+            const bool even = (r % 2 == 0);         // alternate by row
+
+            float x = leftMargin + c * xPadding;    // calculate x position
+            float y = topMargin  + r * yPadding;    // calculate y position
+            enemies.add({x, y}, even ? half1 : half2, even ? Enemy1 : Enemy2, c);
+        }
+    }
+}
+
+/*
+ * Purpose:
+ *      Spawns a player shot at Buzzy's tail.
+ * Input(s):
+ *      const ECE_Buzzy& buzzy      - player (for shot spawn position)
+ *      ECE_LaserPool& playerShots  - pool to spawn the new shot into
+ *      float speed                 - shot speed (+y = down)
+ * Output:
+ *      None (playerShots is modified; the shot is dropped if the pool is full)
+ */
+void spawnPlayerLaser(const ECE_Buzzy& buzzy,
+                      ECE_LaserPool& playerShots,
+                      float speed)
+{
+    BUZZY_PROFILE_ZONE("spawnPlayerLaser");
+    Vector2f p = buzzy.getPosition();
+    playerShots.spawn({p.x, p.y + buzzy.getBounds().height * 0.5f + 10.f},  // spawn at buzzy's tail
+                      {0.f, speed});                                              // velocity of player shot +y (down)
+}
+
+/*
+ * Purpose:
+ *      Spawns an enemy laser from a random alive enemy.
+ * Input(s):
+ *      ECE_LaserPool& enemyShots     - pool to spawn the new shot into
+ *      const ECE_EnemySwarm& enemies - used to pick a live shooter
+ *      float speed                   - shot speed (-y = up)
+ *      std::mt19937& rng             - round RNG (seeded, so replays pick the same shooter)
+ * Output:
+ *      None (enemyShots is modified).
+ * Notes:
+ *      O(1): the shooter is drawn directly from the swarm's alive index.
+ */
+void spawnEnemyLaser(ECE_LaserPool& enemyShots,
+                     const ECE_EnemySwarm& enemies,
+                     float speed,
+                     std::mt19937& rng)
+{
+    BUZZY_PROFILE_ZONE("spawnEnemyLaser");
+    const std::size_t aliveCount = enemies.aliveCount();
+
+    if(aliveCount > 0)
+    { // executes only if there are alive enemies
+        size_t index = rng() % aliveCount;                                                  // forces index into range 0 <= index <= aliveCount - 1
+        const std::size_t shooter = enemies.aliveAt(index);                                     // pick random alive enemy straight from the dense alive index
+        Vector2f p = enemies.getPosition(shooter);                                              // get center of alive enemy
+        enemyShots.spawn({p.x, p.y + enemies.getHalfExtents(shooter).y + 10.f},                 // set shot position
+                         {0.f, speed});                                                         // set shot velocity (-y = up)
+    }
+}
+
+/*
+ * Purpose:
+ *      Update laser positions.
+ * Input(s):
+ *      ECE_LaserPool& playerShots - player lasers
+ *      ECE_LaserPool& enemyShots  - enemy lasers
+ *      float dt                   - delta time (seconds)
+ * Output:
+ *      None
+ */
+void updateShots(ECE_LaserPool& playerShots,
+                 ECE_LaserPool& enemyShots,
+                 float dt)
+{
+    BUZZY_PROFILE_ZONE("updateShots");
+    playerShots.update(dt);
+    enemyShots.update(dt);
+}
+
+/*
+ * Purpose:
+ *      Remove lasers that have left the screen.
+ * Input(s):
+ *      ECE_LaserPool& playerShots - player lasers
+ *      ECE_LaserPool& enemyShots  - enemy lasers
+ *      float windowHeight         - window height (pixels)
+ * Output:
+ *      None (both pools may despawn shots)
+ * Notes:
+ *      Runs after the collision checks, so a shot that crossed a target and
+ *      the screen edge in the same tick still hits.
+ */
+void cullShots(ECE_LaserPool& playerShots,
+               ECE_LaserPool& enemyShots,
+               float windowHeight)
+{
+    BUZZY_PROFILE_ZONE("cullShots");
+    playerShots.cullOffScreen(windowHeight);
+    enemyShots.cullOffScreen(windowHeight);
+}
+
+/*
+ * Purpose:
+ *      March the enemy swarm left/right and step vertically when hitting walls.
+ * Input(s):
+ *      ECE_EnemySwarm& enemies    - mutable swarm
+ *      float dt                   - delta time (seconds)
+ *      float windowWidth          - playfield width (pixels)
+ *      float& enemySpeedX         - horizontal speed (px/s); passed by ref for tunability
+ *      int& dir                   - direction (+1 right, -1 left); flipped on bounce
+ *      float stepUp               - vertical step amount when bouncing (negative to move upward)
+ * Output:
+ *      None (enemies move; dir may flip).
+ * Notes:
+ *      Uses a predictive clamp (nextLeft/nextRight) to avoid “wall slide”.
+ */
+void updateEnemies(ECE_EnemySwarm& enemies,
+                   float dt,
+                   float windowWidth,
+                   float& enemySpeedX,
+                   int& dir,
+                   float stepUp)
+{
+    BUZZY_PROFILE_ZONE("updateEnemies");
+    float minLeft, maxRight;                            // extent of the alive part of the swarm (O(1), tracked on kill)
+    if (!enemies.getExtent(minLeft, maxRight))
+    {
+        return; // no alive enemies
+    }
+
+    const float dx       = enemySpeedX * dir * dt;
+    const float nextLeft  = minLeft  + dx;
+    const float nextRight = maxRight + dx;
+
+    if (nextLeft < 0.f || nextRight > windowWidth)
+    { // executes if the next update hits a wall
+        // Compute a horizontal correction that puts the group just inside the window
+        float correctionX = 0.f;
+        if (nextLeft < 0.f)
+        { // next update hits a wall
+            correctionX = -minLeft;                   // push so minLeft == 0
+        }
+        else
+        { // nextRight > windowWidth
+            correctionX = windowWidth - maxRight;    // push so maxRight == windowWidth
+        }
+
+        enemies.move(correctionX, stepUp);  // clamp + vertical step
+
+        dir *= -1;    // flip once
+        return;       // no horizontal move this frame beyond the clamp
+    }
+
+    // Normal horizontal move
+    enemies.move(dx, 0.f);
+}
+
+/*
+ * Purpose:
+ *      Resolve player-shot vs enemy collisions; kill enemy & remove shot.
+ * Input(s):
+ *      ECE_LaserPool& playerShots       - player lasers
+ *      ECE_EnemySwarm& enemies          - enemy swarm
+ *      const ECE_UniformGrid& enemyGrid - broadphase built from the swarm this tick
+ *      ECE_ShotResolver& resolver       - claim scratch reused across ticks
+ *      ECE_ThreadPool* pool             - workers for the search (nullptr = this thread)
+ * Output:
+ *      None
+ * Notes:
+ *      Collisions are swept: a shot hits an enemy if their boxes overlap at
+ *      any moment of the tick, so a long tick cannot carry a shot through
+ *      an enemy. Each shot only tests enemies binned in the cells its swept
+ *      box overlaps. When a shot reaches several enemies the one it touches
+ *      first is targeted (ties go to the lowest index); when several shots
+ *      target one enemy the first to touch it wins (ties go to the lowest
+ *      slot) and the others look again. The result is the same for any
+ *      thread count.
+ */
+void checkPlayerShotCollisions(ECE_LaserPool& playerShots,
+                               ECE_EnemySwarm& enemies,
+                               const ECE_UniformGrid& enemyGrid,
+                               ECE_ShotResolver& resolver,
+                               ECE_ThreadPool* pool)
+{
+    BUZZY_PROFILE_ZONE("checkPlayerShotCollisions");
+    resolver.resolve(playerShots, enemies, enemyGrid, pool);   // search (parallel), enemies claimed atomically
+    resolver.apply(playerShots, enemies);                      // kills applied in slot order on this thread
+}
+
+/*
+ * Purpose:
+ *      Detect direct player vs enemy sprite overlap (touch = lose).
+ * Input(s):
+ *      const ECE_Buzzy& buzzy           - player
+ *      const ECE_EnemySwarm& enemies    - swarm
+ *      const ECE_UniformGrid& enemyGrid - broadphase built from the swarm this tick
+ * Output:
+ *      bool - true if any alive enemy touched the player during the tick.
+ */
+bool checkPlayerEnemyCollision(const ECE_Buzzy& buzzy,
+                              const ECE_EnemySwarm& enemies,
+                              const ECE_UniformGrid& enemyGrid)
+{
+    BUZZY_PROFILE_ZONE("checkPlayerEnemyCollision");
+    const Vector2f from = buzzy.getPreviousPosition();
+    const Vector2f to   = buzzy.getPosition();
+    const Vector2f half = buzzy.getHalfExtents();
+
+    bool touched = false;
+    enemyGrid.query(sweptBounds(from, to, half), [&](std::size_t i)
+    { // only enemies near the player are tested
+        float t;
+        touched = touched ||
+                  (enemies.isAlive(i) &&
+                   sweptOverlap(from, to, half, enemies.getPreviousPosition(i), enemies.getPosition(i), enemies.getHalfExtents(i), t));
+    });
+    return touched;
+}
+
+/*
+ * Purpose:
+ *      Detect enemy-shot vs player collision. Removes the colliding shot.
+ * Input(s):
+ *      ECE_LaserPool& enemyShots          - enemy lasers (mutable; may despawn)
+ *      const ECE_Buzzy& buzzy             - player
+ *      const ECE_SweepAxis& enemyShotAxis - enemy shots sorted by height, synced this tick
+ * Output:
+ *      bool - true if the player was hit this frame.
+ * Notes:
+ *      Swept: a shot that passed through Buzzy during the tick counts. Only
+ *      shots in Buzzy's vertical band are tested. If several hit, the lowest
+ *      slot is removed.
+ */
+bool checkEnemyShotCollisions(ECE_LaserPool& enemyShots,
+                              const ECE_Buzzy& buzzy,
+                              const ECE_SweepAxis& enemyShotAxis)
+{
+    BUZZY_PROFILE_ZONE("checkEnemyShotCollisions");
+    const Vector2f from     = buzzy.getPreviousPosition();
+    const Vector2f to       = buzzy.getPosition();
+    const Vector2f half     = buzzy.getHalfExtents();
+    const Vector2f shotHalf = enemyShots.getHalfExtents();
+
+    std::size_t hit = enemyShots.size();            // lowest colliding slot so far (size() = none)
+    enemyShotAxis.query(sweptBounds(from, to, half), [&](std::size_t shot)
+    { // only shots level with buzzy
+        float t;
+        if (shot < hit &&
+            sweptOverlap(enemyShots.getPreviousPosition(shot), enemyShots.getPosition(shot), shotHalf, from, to, half, t))
+        { // executes if the current enemy shot touched buzzy during the tick
+            hit = shot;
+        }
+    });
+    if (hit < enemyShots.size())
+    {
+        enemyShots.despawn(hit);
+        return true;
+    }
+    return false;
+}
+
+/*
+ * Purpose:
+ *      Returns true when all enemies are dead (win condition).
+ * Input(s):
+ *      const ECE_EnemySwarm& enemies - swarm
+ * Output:
+ *      bool - true if no enemy is alive; false otherwise.
+ * Notes:
+ *      Counter compare; the swarm tracks its alive count on kill().
+ */
+bool checkWin(const ECE_EnemySwarm& enemies)
+{
+    BUZZY_PROFILE_ZONE("checkWin");
+    return enemies.aliveCount() == 0; // returns true if all enemies are killed - win!
+}
+
+/*
+ * Purpose:
+ *      Records every entity's current position as its previous position
+ *      before a step moves anything (render interpolation).
+ * Input(s):
+ *      ECE_Buzzy& buzzy                  - player
+ *      ECE_EnemySwarm& enemies           - swarm
+ *      ECE_LaserPool& playerShots        - player lasers
+ *      ECE_LaserPool& enemyShots         - enemy lasers
+ * Output:
+ *      None
+ */
+void savePreviousPositions(ECE_Buzzy& buzzy,
+                           ECE_EnemySwarm& enemies,
+                           ECE_LaserPool& playerShots,
+                           ECE_LaserPool& enemyShots)
+{
+    BUZZY_PROFILE_ZONE("savePreviousPositions");
+    buzzy.savePreviousPosition();
+    enemies.savePreviousPositions();
+    playerShots.savePreviousPositions();
+    enemyShots.savePreviousPositions();
+}
+
+/*
+ * Purpose:
+ *      Broadphase cell size for a swarm: the largest scaled enemy dimension,
+ *      so an enemy never spans more than 2x2 cells.
+ * Input(s):
+ *      const ECE_EnemySwarm& enemies - swarm the grid will bin
+ * Output:
+ *      float - cell edge length in pixels
+ */
+float broadphaseCellSize(const ECE_EnemySwarm& enemies)
+{
+    float cellSize = 0.f;
+    for (std::size_t i = 0; i < enemies.size(); ++i)
+    {
+        const Vector2f half = enemies.getHalfExtents(i);
+        cellSize = std::max(cellSize, 2.f * std::max(half.x, half.y));
+    }
+    return cellSize;
+}
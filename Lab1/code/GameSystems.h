@@ -0,0 +1,260 @@
+/*
+Author: Liam Long
+Class: ECE4122
+Last Date Modified: 10/16/26
+Description:
+Header file for the gameplay systems driven by GameState::step(): entity
+factories, spawning, movement, collisions and the win check. Each is a free
+function over the swarm/pool/grid it touches, so it can also be exercised in
+isolation (see Buzzy_Bench.cpp).
+*/
+
+#pragma once
+
+#include "GameState.h"          // GameConfig, entities, broadphases, ECE_ShotResolver, ECE_ThreadPool
+
+/*
+ * Purpose:
+ *      Half-extents of a laser drawn from a texture of the given size: every
+ *      laser is squeezed into a thin 6x18 pixel bolt whatever the texture.
+ * Input(s):
+ *      Vector2u texSize - laser texture size in pixels
+ * Output:
+ *      Vector2f - half width/height in pixels
+ */
+Vector2f laserHalfExtents(Vector2u texSize);
+
+/*
+ * Purpose:
+ *      Builds the player: hitbox fitted to 10% of the window, placed at the
+ *      top center.
+ * Input(s):
+ *      const GameConfig& config - layout and player texture size
+ * Output:
+ *      ECE_Buzzy - scaled and positioned player.
+ */
+ECE_Buzzy makeBuzzy(const GameConfig& config);
+
+/*
+ * Purpose:
+ *      Half-extents of an enemy drawn with a texture of the given size once
+ *      it is scaled uniformly to fit 10% of the window.
+ * Input(s):
+ *      Vector2u texSize    - enemy texture size in pixels
+ *      Vector2u windowSize - window dimensions (for scaling)
+ * Output:
+ *      Vector2f - half width/height in pixels
+ */
+Vector2f enemyHalfExtents(Vector2u texSize, Vector2u windowSize);
+
+/*
+ * Purpose:
+ *      Checks that createEnemies can lay out the config's grid inside the
+ *      window without enemies overlapping.
+ * Input(s):
+ *      const GameConfig& config - grid size, window size and texture sizes
+ * Output:
+ *      bool - false if the grid is empty or too large for the window
+ * Notes:
+ *      At 1920x1080 that allows up to 17 columns and 4 rows.
+ */
+bool enemyGridFits(const GameConfig& config);
+
+/*
+ * Purpose:
+ *      Populate the enemy swarm in a grid, scaled relative to the window.
+ * Input(s):
+ *      ECE_EnemySwarm& enemies      - output swarm (cleared & filled)
+ *      const GameConfig& config     - grid size, window size and texture sizes
+ * Output:
+ *      None (enemies swarm is modified).
+ * Notes:
+ *      Grids too wide or tall for the 120 px spacing are packed closer so
+ *      every enemy starts inside the window (see enemyGridFits).
+ */
+void createEnemies(ECE_EnemySwarm& enemies,
+                   const GameConfig& config);
+
+/*
+ * Purpose:
+ *      Spawns a player shot at Buzzy's tail.
+ * Input(s):
+ *      const ECE_Buzzy& buzzy      - player (for shot spawn position)
+ *      ECE_LaserPool& playerShots  - pool to spawn the new shot into
+ *      float speed                 - shot speed (+y = down)
+ * Output:
+ *      None (playerShots is modified; the shot is dropped if the pool is full)
+ */
+void spawnPlayerLaser(const ECE_Buzzy& buzzy,
+                      ECE_LaserPool& playerShots,
+                      float speed);
+
+/*
+ * Purpose:
+ *      Spawns an enemy laser from a random alive enemy.
+ * Input(s):
+ *      ECE_LaserPool& enemyShots     - pool to spawn the new shot into
+ *      const ECE_EnemySwarm& enemies - used to pick a live shooter
+ *      float speed                   - shot speed (-y = up)
+ *      std::mt19937& rng             - round RNG (seeded, so replays pick the same shooter)
+ * Output:
+ *      None (enemyShots is modified).
+ * Notes:
+ *      O(1): the shooter is drawn directly from the swarm's alive index.
+ */
+void spawnEnemyLaser(ECE_LaserPool& enemyShots,
+                     const ECE_EnemySwarm& enemies,
+                     float speed,
+                     std::mt19937& rng);
+
+/*
+ * Purpose:
+ *      Update laser positions.
+ * Input(s):
+ *      ECE_LaserPool& playerShots - player lasers
+ *      ECE_LaserPool& enemyShots  - enemy lasers
+ *      float dt                   - delta time (seconds)
+ * Output:
+ *      None
+ */
+void updateShots(ECE_LaserPool& playerShots,
+                 ECE_LaserPool& enemyShots,
+                 float dt);
+
+/*
+ * Purpose:
+ *      Remove lasers that have left the screen.
+ * Input(s):
+ *      ECE_LaserPool& playerShots - player lasers
+ *      ECE_LaserPool& enemyShots  - enemy lasers
+ *      float windowHeight         - window height (pixels)
+ * Output:
+ *      None (both pools may despawn shots)
+ * Notes:
+ *      Runs after the collision checks, so a shot that crossed a target and
+ *      the screen edge in the same tick still hits.
+ */
+void cullShots(ECE_LaserPool& playerShots,
+               ECE_LaserPool& enemyShots,
+               float windowHeight);
+
+/*
+ * Purpose:
+ *      March the enemy swarm left/right and step vertically when hitting walls.
+ * Input(s):
+ *      ECE_EnemySwarm& enemies    - mutable swarm
+ *      float dt                   - delta time (seconds)
+ *      float windowWidth          - playfield width (pixels)
+ *      float& enemySpeedX         - horizontal speed (px/s); passed by ref for tunability
+ *      int& dir                   - direction (+1 right, -1 left); flipped on bounce
+ *      float stepUp               - vertical step amount when bouncing (negative to move upward)
+ * Output:
+ *      None (enemies move; dir may flip).
+ * Notes:
+ *      Uses a predictive clamp (nextLeft/nextRight) to avoid “wall slide”.
+ */
+void updateEnemies(ECE_EnemySwarm& enemies,
+                   float dt,
+                   float windowWidth,
+                   float& enemySpeedX,
+                   int& dir,
+                   float stepUp);
+
+/*
+ * Purpose:
+ *      Resolve player-shot vs enemy collisions; kill enemy & remove shot.
+ * Input(s):
+ *      ECE_LaserPool& playerShots       - player lasers
+ *      ECE_EnemySwarm& enemies          - enemy swarm
+ *      const ECE_UniformGrid& enemyGrid - broadphase built from the swarm this tick
+ *      ECE_ShotResolver& resolver       - claim scratch reused across ticks
+ *      ECE_ThreadPool* pool             - workers for the search (nullptr = this thread)
+ * Output:
+ *      None
+ * Notes:
+ *      Collisions are swept: a shot hits an enemy if their boxes overlap at
+ *      any moment of the tick, so a long tick cannot carry a shot through
+ *      an enemy. Each shot only tests enemies binned in the cells its swept
+ *      box overlaps. When a shot reaches several enemies the one it touches
+ *      first is targeted (ties go to the lowest index); when several shots
+ *      target one enemy the first to touch it wins (ties go to the lowest
+ *      slot) and the others look again. The result is the same for any
+ *      thread count.
+ */
+void checkPlayerShotCollisions(ECE_LaserPool& playerShots,
+                               ECE_EnemySwarm& enemies,
+                               const ECE_UniformGrid& enemyGrid,
+                               ECE_ShotResolver& resolver,
+                               ECE_ThreadPool* pool);
+
+/*
+ * Purpose:
+ *      Detect direct player vs enemy sprite overlap (touch = lose).
+ * Input(s):
+ *      const ECE_Buzzy& buzzy           - player
+ *      const ECE_EnemySwarm& enemies    - swarm
+ *      const ECE_UniformGrid& enemyGrid - broadphase built from the swarm this tick
+ * Output:
+ *      bool - true if any alive enemy touched the player during the tick.
+ */
+bool checkPlayerEnemyCollision(const ECE_Buzzy& buzzy,
+                              const ECE_EnemySwarm& enemies,
+                              const ECE_UniformGrid& enemyGrid);
+
+/*
+ * Purpose:
+ *      Detect enemy-shot vs player collision. Removes the colliding shot.
+ * Input(s):
+ *      ECE_LaserPool& enemyShots          - enemy lasers (mutable; may despawn)
+ *      const ECE_Buzzy& buzzy             - player
+ *      const ECE_SweepAxis& enemyShotAxis - enemy shots sorted by height, synced this tick
+ * Output:
+ *      bool - true if the player was hit this frame.
+ * Notes:
+ *      Swept: a shot that passed through Buzzy during the tick counts. Only
+ *      shots in Buzzy's vertical band are tested. If several hit, the lowest
+ *      slot is removed.
+ */
+bool checkEnemyShotCollisions(ECE_LaserPool& enemyShots,
+                              const ECE_Buzzy& buzzy,
+                              const ECE_SweepAxis& enemyShotAxis);
+
+/*
+ * Purpose:
+ *      Returns true when all enemies are dead (win condition).
+ * Input(s):
+ *      const ECE_EnemySwarm& enemies - swarm
+ * Output:
+ *      bool - true if no enemy is alive; false otherwise.
+ * Notes:
+ *      Counter compare; the swarm tracks its alive count on kill().
+ */
+bool checkWin(const ECE_EnemySwarm& enemies);
+
+/*
+ * Purpose:
+ *      Records every entity's current position as its previous position
+ *      before a step moves anything (render interpolation).
+ * Input(s):
+ *      ECE_Buzzy& buzzy                  - player
+ *      ECE_EnemySwarm& enemies           - swarm
+ *      ECE_LaserPool& playerShots        - player lasers
+ *      ECE_LaserPool& enemyShots         - enemy lasers
+ * Output:
+ *      None
+ */
+void savePreviousPositions(ECE_Buzzy& buzzy,
+                           ECE_EnemySwarm& enemies,
+                           ECE_LaserPool& playerShots,
+                           ECE_LaserPool& enemyShots);
+
+/*
+ * Purpose:
+ *      Broadphase cell size for a swarm: the largest scaled enemy dimension,
+ *      so an enemy never spans more than 2x2 cells.
+ * Input(s):
+ *      const ECE_EnemySwarm& enemies - swarm the grid will bin
+ * Output:
+ *      float - cell edge length in pixels
+ */
+float broadphaseCellSize(const ECE_EnemySwarm& enemies);